@@ -29,112 +29,2966 @@
  *      expr.bindTo(obj, &Class::setProperty);
  *      expr.bindTo([](int v){});
  *      @endcode
+ *
+ * Bindings made with Qt::QueuedConnection only mark themselves dirty when a source changes, and are evaluated once
+ * per event loop turn, before the next paint:
+ *      @code{.cpp}
+ *      expr.bindTo(label.text(), Qt::QueuedConnection);
+ *      @endcode
+ *
+ * Bindings targeting widgets under a root opted in with deferWhileHidden() are only marked stale while their target is
+ * hidden, and catch up once it is shown:
+ *      @code{.cpp}
+ *      deferWhileHidden(tabWidget);
+ *      @endcode
+ *
+ * Likewise bindings targeting widgets scrolled out of a viewport opted in with cullOutsideViewport() wait until they
+ * are scrolled into view:
+ *      @code{.cpp}
+ *      cullOutsideViewport(scrollArea);
+ *      @endcode
+ *
+ * Bindings created inside a Construction are evaluated together when it closes, writers before their readers:
+ *      @code{.cpp}
+ *      auto layout = Construction::build([&]() { return FormLayout{...}; });
+ *      @endcode
+ *
+ * Properties of objects living in another thread are read from a single slot mailbox the owning thread publishes the
+ * latest value into, a binding evaluates once per event loop turn however often they change:
+ *      @code{.cpp}
+ *      label.text() = asprintf_("%f", worker.price()); // worker moved to a worker thread
+ *      qint64 dropped = overwrittenUpdates(worker.price());
+ *      @endcode
+ *
+ * Expensive pure functions can be evaluated in QThreadPool with async_(), results of outdated arguments are dropped:
+ *      @code{.cpp}
+ *      list.items() = async_or_(QStringList{}, filter, model.lines(), edit.text());
+ *      @endcode
+ *
+ * Bursts of changes can be rate limited with throttle(), debounce() and sample(), sharing a single timer per thread:
+ *      @code{.cpp}
+ *      label.text() = invoke(expensive, debounce(edit.text(), 300));
+ *      @endcode
+ *
+ * Aggregates over a runtime collection of properties update incrementally when one of them changes:
+ *      @code{.cpp}
+ *      QVector<decltype(spinBox.value())> cells = ...;
+ *      total.value() = sum_(cells);
+ *      @endcode
+ *
+ * A sub-expression read by many bindings can be shared as a Computed, evaluated once per change:
+ *      @code{.cpp}
+ *      Computed<int> area = width.value() * height.value();
+ *      label.text()  = asprintf_("%d", area);
+ *      bar.value()   = area;
+ *      @endcode
+ *
+ * Application state without a QObject can be held in Value cells, read by bindings like properties:
+ *      @code{.cpp}
+ *      Value<bool> busy = false;
+ *      button.enabled() = !busy;
+ *      busy = true;
+ *      @endcode
+ *
+ * Properties without a notify signal, as geometry, font or palette, are notified by the events changing them:
+ *      @code{.cpp}
+ *      label.text() = asprintf_("%dx%d", widget.width(), widget.height());
+ *      @endcode
+ *
+ * Once several properties of an object are read through the same notify signal, as QAction::changed, each source
+ * caches its value and only wakes its readers when it changed.
+ *
+ * A notify signal carrying a value of the property type, as QSlider::valueChanged(int), hands it to the readers woken
+ * by it, the getter is only called when the value is read outside of that propagation.
+ *
+ * bindTo returns a BindingHandle, which suspends, resumes or unbinds the binding:
+ *      @code{.cpp}
+ *      ScopedBinding binding = (a.value() + b.value()).bindTo(c.value()); // unbound once out of scope
+ *      @endcode
+ *
+ * Two properties can be kept in sync with twoWay(), each change is written back at most once per propagation:
+ *      @code{.cpp}
+ *      twoWay(celsius.value(), fahrenheit.value(), toFahrenheit, toCelsius);
+ *      @endcode
+ * A binding evaluated more than N_BINDING_CYCLE_LIMIT times within one propagation, queued and deferred evaluations
+ * included, is reported with the cycle leading back to it, and the propagation is stopped.
+ *
+ * An invoke() node keeps its last result while its arguments compare equal, so a change leaving an intermediate result
+ * unchanged stops there:
+ *      @code{.cpp}
+ *      label.text() = invoke(format, cond(slider.value() > 50, 1, 0)); // format runs when the level flips only
+ *      @endcode
+ *
+ * Expensive values of arguments toggling among a few values can be cached by memo_(), keeping the results of the last
+ * N_BINDING_MEMO_CAPACITY argument tuples, counted by memoHits() and memoMisses():
+ *      @code{.cpp}
+ *      item.icon() = memo_(constructor<QIcon>(asprintf_(":/status/%d.png", task.state())));
+ *      @endcode
  */
 
 #ifndef NWIDGET_BINDING_H
 #define NWIDGET_BINDING_H
 
-#include "metaobject.h"
+#include "metaobject.h"
+
+#include <QAbstractScrollArea>
+#include <QBasicTimer>
+#include <QElapsedTimer>
+#include <QEvent>
+#include <QHash>
+#include <QMap>
+#include <QMutex>
+#include <QObject>
+#include <QPointer>
+#include <QRunnable>
+#include <QScrollBar>
+#include <QSet>
+#include <QSharedPointer>
+#include <QStringList>
+#include <QThread>
+#include <QThreadPool>
+#include <QTimerEvent>
+#include <QVector>
+#include <QWidget>
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <list>
+#include <memory>
+#include <set>
+#include <vector>
+
+#ifndef N_BINDING_TIMER_TICK
+#define N_BINDING_TIMER_TICK 4 // Resolution in ms of throttle(), debounce() and sample()
+#endif
+
+#ifndef N_BINDING_MEMO_CAPACITY
+#define N_BINDING_MEMO_CAPACITY 16 // Default number of results cached by memo_()
+#endif
+
+#ifndef N_BINDING_CYCLE_LIMIT
+#ifdef QT_NO_DEBUG
+#define N_BINDING_CYCLE_LIMIT 10000 // Only stops a cycle from spinning in release builds
+#else
+#define N_BINDING_CYCLE_LIMIT 100 // Runs of a binding within one propagation reported as a cycle, 0 disables it
+#endif
+#endif
+
+namespace nwidget {
+
+namespace impl {
+
+template <typename T, typename = void> struct has_equal : std::false_type
+{
+};
+
+template <typename T>
+struct has_equal<T, impl::void_t<decltype(bool(std::declval<const T&>() == std::declval<const T&>()))>>
+    : std::true_type
+{
+};
+
+} // namespace impl
+
+/**
+ * @brief Whether bindings compare a value with the previous one and drop it when they are equal.
+ * @details
+ * Also decides whether an invoke() node compares its arguments with the previous ones and keeps its last result while
+ * they are equal. Enabled for every type with operator==, specialize it for types comparing slower than they are set:
+ *      @code{.cpp}
+ *      template <> struct nwidget::equality_cutoff<QImage> : std::false_type {};
+ *      @endcode
+ */
+template <typename T> struct equality_cutoff : impl::has_equal<T>
+{
+};
+
+/**
+ * @brief Base of actions receiving their arguments unevaluated.
+ * @details
+ * Each argument is passed as a thunk, calling it evaluates the argument, so untaken branches cost nothing:
+ *      @code{.cpp}
+ *      struct ActionFirstNonEmpty : LazyAction
+ *      {
+ *          template <typename A, typename B> QString operator()(const A& a, const B& b) const
+ *          {
+ *              const QString v = a();
+ *              return v.isEmpty() ? b() : v;
+ *          }
+ *      };
+ *      label.text() = makeBindingExpr<ActionFirstNonEmpty>(edit1.text(), edit2.text());
+ *      @endcode
+ */
+struct LazyAction
+{
+};
+
+template <typename T> class Computed;
+template <typename T> class Value;
+class BindingHandle;
+
+namespace impl {
+
+struct TwoWay;
+struct Memo;
+
+struct ActionEmpty
+{
+    template <typename T> auto operator()(T&& val) const { return val; }
+};
+
+// clang-format off
+
+template <typename ...T> struct is_observable;
+
+template <typename T> constexpr bool is_observable_v = is_observable<T>::value;
+
+template <typename T> struct is_observable<T>
+    : std::false_type {};
+
+// Properties without a notify signal may still be notified by events, BindingExpr<>::observable() looks them up
+template <typename ...T> struct is_observable<MetaProperty<T...>>
+    : std::true_type {};
+
+template <typename Action, typename... Args> struct is_observable<BindingExpr<Action, Args...>>
+    : std::integral_constant<bool, impl::fold<std::logical_or<bool>, std::false_type, is_observable<Args>...>::value> {};
+
+// Base of stateful expression nodes, shared by the copies of an expression and notifying through a source of their own
+struct ObservableNode {};
+
+template <typename T> struct is_observable<std::shared_ptr<T>>
+    : std::is_base_of<ObservableNode, T> {};
+
+template <typename T> struct is_observable<Computed<T>>
+    : std::true_type {};
+
+template <typename T> struct is_observable<Value<T>>
+    : std::true_type {};
+
+template<typename T> struct is_meta_property : std::false_type {};
+template<typename T> constexpr bool is_meta_property_v = is_meta_property<T>::value;
+template<typename... T> struct is_meta_property<MetaProperty<T...>> : std::true_type {};
+
+template<typename T> struct is_binding_expr : std::false_type {};
+template<typename T> constexpr bool is_binding_expr_v = is_binding_expr<T>::value;
+template<typename... T> struct is_binding_expr<BindingExpr<T...>> : std::true_type {};
+template<typename T> struct is_binding_expr<Computed<T>> : std::true_type {};
+template<typename T> struct is_binding_expr<Value<T>> : std::true_type {};
+
+template<typename Action> struct is_lazy_action : std::is_base_of<LazyAction, Action> {};
+
+// clang-format on
+
+/* ----------------------------------------------------- Cutoff ----------------------------------------------------- */
+
+// Remembers the last value passed through a binding
+template <typename T, bool = equality_cutoff<T>::value> class Cutoff
+{
+public:
+    bool changed(const T& val)
+    {
+        if (!last) {
+            last = std::make_shared<T>(val);
+            return true;
+        }
+        if (*last == val)
+            return false;
+        *last = val;
+        return true;
+    }
+
+private:
+    std::shared_ptr<T> last;
+};
+
+template <typename T> class Cutoff<T, false>
+{
+public:
+    template <typename U> bool changed(const U&) { return true; }
+};
+
+// clang-format off
+template <typename T> struct is_pointer_like                    : std::is_pointer<T> {};
+template <typename T> struct is_pointer_like<std::shared_ptr<T>> : std::true_type {};
+template <typename T> struct is_pointer_like<QSharedPointer<T>>  : std::true_type {};
+template <typename T> struct is_pointer_like<QPointer<T>>        : std::true_type {};
+// clang-format on
+
+// Values an expression node result can be assumed to depend on only, pointed objects may change behind them
+template <typename T>
+struct is_stable_arg
+    : std::integral_constant<bool,
+                             !is_pointer_like<T>::value || std::is_function<std::remove_pointer_t<T>>::value
+                                 || std::is_same<T, const char*>::value>
+{
+};
+
+// Arguments a node result can be cached by
+template <typename T>
+struct is_cutoff_arg : std::integral_constant<bool, equality_cutoff<T>::value && is_stable_arg<T>::value>
+{
+};
+
+/* --------------------------------------------------- Propagation -------------------------------------------------- */
+
+class Binding;
+class BindingObject;
+class BindingSource;
+struct Relay;
+
+// Removes item i of a membership list, positions holding the position of the owner in the list back of each item. The
+// last item takes its place and its list is told the new position, so no list is searched
+template <typename T> void swapRemove(QVector<T*>& items, QVector<int>& positions, int i, QVector<int> T::*back)
+{
+    const int last = items.size() - 1;
+    if (i != last) {
+        items[i]                        = items[last];
+        positions[i]                    = positions[last];
+        (items[i]->*back)[positions[i]] = i;
+    }
+    items.removeLast();
+    positions.removeLast();
+}
+
+// Event filter shared by every object of a thread, dispatches to the binding data of the receiver
+class BindingFilter : public QObject
+{
+public:
+    inline bool eventFilter(QObject* obj, QEvent* event) override;
+};
+
+// Events changing the properties without a notify signal, keyed by "Class::property", which covers its subclasses
+inline QHash<QByteArray, QVector<QEvent::Type>>& eventNotifiers()
+{
+    static QHash<QByteArray, QVector<QEvent::Type>> notifiers{
+        {"QWidget::geometry", {QEvent::Move, QEvent::Resize}},
+        {"QWidget::frameGeometry", {QEvent::Move, QEvent::Resize}},
+        {"QWidget::x", {QEvent::Move}},
+        {"QWidget::y", {QEvent::Move}},
+        {"QWidget::pos", {QEvent::Move}},
+        {"QWidget::frameSize", {QEvent::Resize}},
+        {"QWidget::size", {QEvent::Resize}},
+        {"QWidget::width", {QEvent::Resize}},
+        {"QWidget::height", {QEvent::Resize}},
+        {"QWidget::rect", {QEvent::Resize}},
+        {"QFrame::frameRect", {QEvent::Resize}},
+        {"QWidget::palette", {QEvent::PaletteChange}},
+        {"QWidget::font", {QEvent::FontChange}},
+        {"QWidget::styleSheet", {QEvent::StyleChange}},
+        {"QFrame::frameWidth", {QEvent::StyleChange, QEvent::ContentsRectChange}},
+        {"QWidget::enabled", {QEvent::EnabledChange}},
+        {"QWidget::layoutDirection", {QEvent::LayoutDirectionChange}},
+        {"QWidget::locale", {QEvent::LocaleChange}},
+    };
+    return notifiers;
+}
+
+// Bumped by every change of eventNotifiers(), which invalidates the lookups of notifyEvents()
+inline std::atomic<int>& eventNotifiersVersion()
+{
+    static std::atomic<int> version{0};
+    return version;
+}
+
+template <typename C, std::enable_if_t<std::is_base_of<QObject, C>::value, bool> = true>
+QVector<QEvent::Type> findEventNotifiers(const char* name)
+{
+    const auto& notifiers = eventNotifiers();
+    for (auto meta = &C::staticMetaObject; meta; meta = meta->superClass()) {
+        const auto it = notifiers.find(QByteArray(meta->className()) + "::" + name);
+        if (it != notifiers.end())
+            return *it;
+    }
+    return {};
+}
+
+template <typename C, std::enable_if_t<!std::is_base_of<QObject, C>::value, bool> = true>
+QVector<QEvent::Type> findEventNotifiers(const char*)
+{
+    return {};
+}
+
+// Type of the first argument of a notify signal, void if it has none
+template <typename Signal> struct notify_arg
+{
+    using type = void;
+};
+
+template <typename C, typename A, typename... As> struct notify_arg<void (C::*)(A, As...)>
+{
+    using type = std::decay_t<A>;
+};
+
+template <typename Signal> using notify_arg_t = typename notify_arg<Signal>::type;
+
+// Looked up again once notifyOnEvent() changed the table
+template <typename Prop> const QVector<QEvent::Type>& notifyEvents()
+{
+    struct Lookup
+    {
+        int                   version = -1;
+        QVector<QEvent::Type> events;
+    };
+    static thread_local Lookup lookup;
+
+    const int version = eventNotifiersVersion();
+    if (lookup.version != version) {
+        lookup.version = version;
+        lookup.events  = findEventNotifiers<typename Prop::Class>(Prop::Info::name());
+    }
+    return lookup.events;
+}
+
+/**
+ * @brief Identity of a binding target or an observed property, unique per type.
+ * @details
+ * Bindings to properties are keyed by the property's Info type, which also keys the property's BindingSource, so a
+ * binding finds the hub of its target property with a single lookup.
+ */
+using BindingKey = const void*;
+
+// Writable, so identical code folding (MSVC /OPT:ICF) never merges the keys of two types
+template <typename T> BindingKey bindingKey()
+{
+    static char key;
+    return &key;
+}
+
+/**
+ * @brief Rank ordered propagation queue, one per thread.
+ * @details
+ * A binding's rank is greater than the rank of every binding writing one of its sources, so flushing the queue in
+ * ascending rank order evaluates each binding once per change, after all of its inputs have settled:
+ *      @code{.cpp}
+ *      b.value() = a.value();                  // rank 1
+ *      c.value() = a.value() * 2;              // rank 1
+ *      label.text() = asprintf_("%d", b.value() + c.value()); // rank 2, evaluated once per change of a
+ *      @endcode
+ */
+class BindingEngine
+{
+    N_DISABLE_COPY_MOVE(BindingEngine)
+
+    friend class Binding;
+    friend class BindingObject;
+    friend class BindingSource;
+
+public:
+    static BindingEngine& instance()
+    {
+        static thread_local BindingEngine engine;
+        return engine;
+    }
+
+    inline ~BindingEngine();
+
+    inline void schedule(Binding* binding);
+    inline void defer(Binding* binding);
+    inline void post(std::shared_ptr<Relay> relay); // Thread safe, notifies the source of relay in this thread
+    inline void cancel(Binding* binding);
+    inline void flush();
+    inline void reportCycle(Binding* binding); // Warns with the cycle through binding and drops the queue
+
+    void begin() { ++depth; }
+    void commit()
+    {
+        if (--depth == 0)
+            flush();
+    }
+
+    // Number of notifications coalesced into an already pending evaluation
+    qint64 skipped() const { return skipped_; }
+
+    // Incremented by each change made outside of a binding, shared by all the updates it propagates
+    quint64 epoch() const { return epoch_; }
+
+    void        beginConstruction() { ++constructing; }
+    inline void endConstruction();
+
+    bool        isTracking() const { return tracking; }
+    Binding*    current() const { return tracking; } // Binding being evaluated, nullptr if none
+    inline void read(BindingSource* source); // Records a source read by the binding being evaluated
+    inline void pull(Binding* binding);      // Evaluates binding now if it waits for the end of a construction
+    bool        hasPending() const { return !pending.isEmpty(); }
+
+    // Source of prop read by the binding being evaluated, looked up through the leaves it read last time
+    template <typename Prop> BindingSource* source(Prop prop);
+
+    // Argument of the notify signal of source being delivered, nullptr if it has to be read from the getter
+    const void* payload(const BindingSource* source) const { return source == delivering ? payload_ : nullptr; }
+
+    // Thread safe, runs func in the thread of the engine
+    template <typename Func> void dispatch(Func func)
+    {
+        QMetaObject::invokeMethod(&context, std::move(func), Qt::QueuedConnection);
+    }
+
+private:
+    BindingEngine() = default;
+
+    Binding* tracking = nullptr; // Binding being evaluated
+
+    const BindingSource* delivering = nullptr; // Source notified with the new value, until its readers have run
+    const void*          payload_   = nullptr;
+
+    // Bindings of a rank in scheduling order, drained by index. A cancelled binding leaves a null entry behind
+    struct Rank
+    {
+        QVector<Binding*> bindings;
+        int               next = 0;
+    };
+
+    QMap<int, Rank> queue;
+    bool            flushing = false;
+    int             depth    = 0; // Nesting of open transactions
+    qint64          skipped_ = 0;
+    quint64         epoch_   = 0; // Propagation, started by a change made outside of any binding
+    quint64         stamp    = 0; // Marks the sources seen by an evaluation or a tracking pass
+
+    int               constructing = 0; // Nesting of open constructions
+    QVector<Binding*> pending;          // Created by the constructions, not evaluated yet. Pulled ones leave a null
+    int               pendingNext  = 0; // Drained up to here
+
+    QObject           context; // Receives the deferred flush, lives in the thread of the engine
+    BindingFilter     filter;
+    int               viewports   = 0; // Culling the bindings of their descendants
+    int               suspensions = 0; // Roots of suspended subtrees
+    int               deferRoots  = 0; // Deferring the bindings of their hidden descendants
+    QVector<Binding*> deferred; // Null once cancelled
+    bool              flushPosted = false;
+
+    QMutex                          mutex; // Guards inbox
+    QVector<std::shared_ptr<Relay>> inbox;
+    bool                            inboxPosted = false;
+
+    QHash<const QObject*, BindingObject*> objects; // Binding data of the objects read or written in the thread
+
+    inline void flushDeferred();
+    inline void flushInbox();
+    inline void drop(BindingObject* data);
+};
+
+/**
+ * @brief Binding data attached to a QObject, created once the object is read or written by a binding.
+ * @details
+ * Owns the bindings targeting the object and the notify hubs of its observed properties. A single connection to
+ * QObject::destroyed tears them down together with every binding reading the object.
+ *
+ * Each thread keeps the data of the objects its bindings read or write, only touched in that thread. An object
+ * destroyed in another thread is torn down in the thread of its data.
+ */
+class BindingObject
+{
+    N_DISABLE_COPY_MOVE(BindingObject)
+
+    friend class Binding;
+    friend class BindingEngine;
+    friend class BindingFilter;
+
+public:
+    static BindingObject* find(const QObject* obj)
+    {
+        const auto data = BindingEngine::instance().objects.value(obj);
+        return data && !data->dead ? data : nullptr;
+    }
+
+    // obj is alive: the bindings watching an object destroyed in another thread no longer run, so a dead entry
+    // belongs to a previous object at the same address and is left to its teardown
+    static BindingObject* get(QObject* obj)
+    {
+        auto& data = BindingEngine::instance().objects[obj];
+        if (!data || data->dead)
+            data = new BindingObject(obj);
+        return data;
+    }
+
+    inline ~BindingObject();
+
+    Binding*       findBinding(BindingKey key) const { return bindings.value(key); }
+    BindingSource* findSource(BindingKey key) const { return sources.value(key); }
+
+    template <typename Prop> BindingSource* source(Prop prop);
+
+    inline void notifyEvent(QEvent* event);
+
+    inline void setDeferHidden(bool enable);
+    inline void setCullViewport(QAbstractScrollArea* area, bool enable);
+    inline void setSuspended(bool enable);
+
+private:
+    QObject*                            object;
+    BindingEngine*                      engine;   // Of the thread the data belongs to
+    QHash<BindingKey, Binding*>         bindings; // Targeting the object, owned
+    QHash<BindingKey, BindingSource*>   sources;
+    QVector<Binding*>                   watchers; // Reading the object, deleted with it
+    QVector<int>                        watcherSlots; // Position of the object in the watched objects of each watcher
+    QVector<Binding*>                   stale;    // Held until the object is shown or scrolled
+    QHash<int, QVector<BindingSource*>> events;   // Sources notified by the events of the object
+    QHash<int, QVector<BindingSource*>> notifiers; // Sources of each notify signal, filtered once shared
+    bool                                deferHidden  = false; // Applies to the object and its descendants
+    bool                                cullViewport = false; // Object is the viewport of a scroll area
+    bool                                suspended    = false; // Holds the bindings of the object and its descendants
+    QVector<QMetaObject::Connection>    scrolling;
+    QMetaObject::Connection             destroyed;
+    std::atomic<bool>                   dead{false}; // Object destroyed, the data waits for its teardown
+
+    explicit BindingObject(QObject* obj)
+        : object(obj)
+        , engine(&BindingEngine::instance())
+    {
+        const auto data   = this;
+        const auto thread = QThread::currentThread(); // Of the engine
+        destroyed         = QObject::connect(obj,
+                                     &QObject::destroyed,
+                                     [engine = engine, data, thread]()
+                                     {
+                                         if (QThread::currentThread() == thread) {
+                                             engine->drop(data);
+                                             return;
+                                         }
+                                         data->dead = true;
+                                         engine->dispatch([engine, data]() { engine->drop(data); });
+                                     });
+    }
+
+    inline BindingObject* culler();
+    inline void           hold(Binding* binding);
+    inline void           reveal();
+
+    template <typename Prop> void observe(BindingSource* source, Prop prop, std::true_type);
+    template <typename Prop> void observe(BindingSource* source, Prop prop, std::false_type);
+
+    template <typename Prop, typename Sink>
+    static QMetaObject::Connection connectNotify(Prop prop, Sink sink, std::true_type);
+    template <typename Prop, typename Sink>
+    static QMetaObject::Connection connectNotify(Prop prop, Sink sink, std::false_type);
+};
+
+class Binding
+{
+    N_DISABLE_COPY_MOVE(Binding)
+
+    friend class BindingEngine;
+    friend class BindingObject;
+    friend class BindingSource;
+    friend class nwidget::BindingHandle;
+
+public:
+    Binding(BindingObject* owner, BindingKey key)
+        : owner(owner)
+        , key(key)
+        , engine(owner ? owner->engine : &BindingEngine::instance())
+    {
+        if (owner)
+            owner->bindings.insert(key, this);
+    }
+
+    inline ~Binding();
+
+    int rank() const { return rank_; }
+
+    void setFunc(std::function<void()> func, Qt::ConnectionType type)
+    {
+        this->func = std::move(func);
+        this->type = type;
+        updateRank();
+    }
+
+    inline void run();
+    inline void refresh(); // Runs the binding, or holds it until its target is shown or scrolled into view
+
+    // Deletes the binding once obj is destroyed
+    void watch(QObject* obj)
+    {
+        auto data = BindingObject::get(obj);
+        if (watched.contains(data))
+            return;
+        watched.append(data);
+        watchedSlots.append(data->watchers.size());
+        data->watchers.append(this);
+        data->watcherSlots.append(watched.size() - 1);
+    }
+
+    template <typename Expr> void watchAll(const Expr& expr); // Watches the objects of every branch of expr
+
+    template <typename Prop> BindingSource* leaf(Prop prop); // Source of the next property read by the evaluation
+
+    // Binding owned by an expression node, stopped rather than deleted once a watched object is destroyed
+    void setOwned() { owned = true; }
+
+    // Writes source, which is ranked after every binding writing it
+    inline void setTarget(BindingSource* source);
+
+    // Name of the target property, only used to describe the binding
+    void setName(const char* name) { this->name = name; }
+
+    inline QString           describe() const; // "Class(objectName).property"
+    inline QVector<Binding*> cycle();          // Bindings leading from this one back to it, empty if none
+
+    inline void notify();
+    inline void reset();
+    inline void rebind(); // Reused by a new expression, the handles of the previous one no longer control it
+
+    // A suspended binding only records that it is dirty, it is evaluated once when resumed
+    inline void suspend();
+    inline void resume();
+
+private:
+    BindingObject*        owner;
+    BindingObject*        holder = nullptr; // Holding the binding while its target is culled
+    BindingSource*        target = nullptr; // Written source of a binding owned by a node
+    BindingKey            key;
+    const char*           name = nullptr;
+    std::function<void()> func;
+    Qt::ConnectionType    type = Qt::AutoConnection;
+    BindingEngine*        engine; // Of the thread of the target, the binding runs in it only
+
+    QVector<BindingSource*> sources;      // Read by the last evaluation
+    QVector<int>            sourceSlots;  // Position of the binding in the bindings of each source
+    QVector<BindingSource*> reading;      // Read by the running evaluation
+    QVector<BindingObject*> watched;
+    QVector<int>            watchedSlots; // Position of the binding in the watchers of each watched object
+
+    // Properties read by the evaluations in reading order, an evaluation mostly reads them in the same order again
+    struct Leaf
+    {
+        const QObject* object;
+        BindingKey     key;
+        BindingSource* source;
+    };
+    QVector<Leaf> leaves;
+    int           cursor = 0;
+    quint64       stamp  = 0; // Of the running evaluation
+
+    BindingHandle* handles = nullptr; // Reset once the binding is deleted
+
+    quint64 runEpoch = 0; // Propagation the runs are counted in
+    int     runs     = 0;
+
+    int  rank_        = 1;
+    int  queuedRank   = 0;
+    int  queuedSlot   = 0; // Position in the bindings of its rank
+    int  deferredSlot = 0; // Position in the deferred bindings
+    int  pendingSlot  = 0; // Position in the bindings pending on the construction
+    bool queued       = false;
+    bool deferred     = false;
+    bool pending      = false;
+    bool owned        = false;
+    bool suspended    = false;
+    bool dirty        = false;
+    bool ranking      = false;
+
+    inline void release();
+    inline void resetHandles();
+    inline void subscribe(BindingSource* source);
+    inline void unsubscribe(int i); // From sources[i]
+    inline void unwatch(int i);     // From watched[i]
+    inline bool findCycle(QVector<Binding*>& path, QSet<Binding*>& visited);
+    inline void track();
+    inline void updateRank();
+    inline void setRank(int rank);
+};
+
+/**
+ * @brief Latest value of a property living in another thread.
+ * @details
+ * The owning thread publishes into a single slot with a lock-free exchange, the reading thread takes the slot and keeps
+ * it as the latest value. A value published before the previous one was taken overwrites it.
+ */
+class Mailbox
+{
+    N_DISABLE_COPY_MOVE(Mailbox)
+
+public:
+    Mailbox()          = default;
+    virtual ~Mailbox() = default;
+
+    virtual void publish(const void* value) = 0; // Called in the thread of the property, value may be nullptr
+
+    qint64 overwritten() const { return overwritten_; }
+
+    static std::atomic<qint64>& total()
+    {
+        static std::atomic<qint64> overwritten{0};
+        return overwritten;
+    }
+
+protected:
+    std::atomic<qint64> overwritten_{0};
+};
+
+/**
+ * @brief Carries the changes of a property living in another thread to its source in the reading thread.
+ * @details
+ * Shared by the notify connection and the source, the thread of the property only touches the mailbox and the inbox
+ * of the reading engine. The source is notified in the reading thread, at most once per event loop turn.
+ */
+struct Relay
+{
+    Relay(Mailbox* mailbox, BindingSource* source, BindingEngine* engine)
+        : mailbox(mailbox)
+        , source(source)
+        , engine(engine)
+    {
+    }
+
+    std::unique_ptr<Mailbox> mailbox;
+    BindingSource*           source; // Reset once deleted, only touched in the reading thread
+    BindingEngine*           engine; // Of the reading thread
+    std::atomic<bool>        posted{false};
+};
+
+template <typename Prop> class MailboxOf : public Mailbox
+{
+    using T = typename Prop::Type;
+
+public:
+    explicit MailboxOf(Prop prop) : prop(prop) {}
+    ~MailboxOf() override { delete slot.load(); }
+
+    void publish(const void* value) override
+    {
+        const auto latest = value ? new T(*static_cast<const T*>(value)) : new T(prop.get());
+        if (const auto old = slot.exchange(latest)) {
+            delete old;
+            ++overwritten_;
+            ++total();
+        }
+    }
+
+    // Default value until the thread of the property seeds the mailbox
+    T read()
+    {
+        if (const auto value = slot.exchange(nullptr))
+            latest.reset(value);
+        return latest ? *latest : T{};
+    }
+
+private:
+    Prop               prop;
+    std::atomic<T*>    slot{nullptr};
+    std::unique_ptr<T> latest;
+};
+
+// Last value of a property notified by a signal shared with other properties
+class ChangeFilter
+{
+    N_DISABLE_COPY_MOVE(ChangeFilter)
+
+public:
+    ChangeFilter()          = default;
+    virtual ~ChangeFilter() = default;
+
+    // Called in the thread of the property with the argument of the signal, if any. Returns the new value, which the
+    // readers take as the payload, nullptr if it is unchanged
+    virtual const void* changed(const void* value) = 0;
+};
+
+template <typename Prop> class ChangeFilterOf : public ChangeFilter
+{
+    using T = typename Prop::Type;
+
+public:
+    explicit ChangeFilterOf(QObject* obj)
+        : prop(static_cast<typename Prop::Class*>(obj))
+        , last(prop.get())
+    {
+    }
+
+    const void* changed(const void* value) override
+    {
+        T latest = value ? *static_cast<const T*>(value) : prop.get();
+        if (equal(latest, last, equality_cutoff<T>{}))
+            return nullptr;
+        last = std::move(latest);
+        return &last;
+    }
+
+    static ChangeFilter* make(QObject* obj) { return new ChangeFilterOf(obj); }
+
+private:
+    Prop prop;
+    T    last;
+
+    static bool equal(const T& a, const T& b, std::true_type) { return a == b; }
+    static bool equal(const T&, const T&, std::false_type) { return false; }
+};
+
+// Whether signal notifies several properties of meta, as QAction::changed does
+inline bool isSharedNotify(const QMetaObject* meta, int signal)
+{
+    static thread_local QHash<QPair<const QMetaObject*, int>, bool> shared;
+
+    const auto key = qMakePair(meta, signal);
+    auto       it  = shared.find(key);
+    if (it == shared.end()) {
+        int count = 0;
+        for (int i = 0; i < meta->propertyCount(); ++i)
+            count += meta->property(i).notifySignalIndex() == signal;
+        it = shared.insert(key, count > 1);
+    }
+    return *it;
+}
+
+/**
+ * @brief Notify hub of an observable property, shared by every binding reading it.
+ * @details
+ * The notify signal is connected once per property, all bindings are scheduled before the queue is flushed, so a
+ * change fanning out to several bindings never lets one of them observe the others half updated.
+ */
+class BindingSource
+{
+    N_DISABLE_COPY_MOVE(BindingSource)
+
+    friend class Binding;
+    friend class BindingEngine;
+    friend class BindingObject;
+
+public:
+    // Hub of a value living outside of any QObject
+    BindingSource()
+        : owner(nullptr)
+        , key(nullptr)
+    {
+    }
+
+    ~BindingSource()
+    {
+        if (writer)
+            writer->target = nullptr;
+        QObject::disconnect(connection);
+        while (!bindings.isEmpty())
+            bindings.last()->unsubscribe(bindingSlots.last());
+        auto& engine = BindingEngine::instance();
+        if (auto binding = engine.tracking)
+            binding->reading.removeAll(this);
+        if (engine.delivering == this)
+            engine.delivering = nullptr;
+        if (relay)
+            relay->source = nullptr;
+    }
+
+    template <typename Prop> static BindingSource* get(Prop prop)
+    {
+        return BindingObject::get(prop.object())->source(prop);
+    }
+
+    // Of a source observing a property of another thread
+    template <typename Prop> MailboxOf<Prop>* mailbox(Prop) { return static_cast<MailboxOf<Prop>*>(findMailbox()); }
+
+    Mailbox* findMailbox() const { return relay ? relay->mailbox.get() : nullptr; }
+
+    const QVector<Binding*>& readers() const { return bindings; }
+
+    // Readers of one of the properties of a shared notify signal are only woken when that property changed
+    void signaled(const void* value)
+    {
+        if (!filter)
+            notify(value);
+        else if (const auto latest = filter->changed(value))
+            notify(latest);
+    }
+
+    // value is the new value carried by the notify signal, if any
+    void notify(const void* value = nullptr)
+    {
+        // Emitted from a setter, reads in the slots belong to no binding
+        auto&      engine   = BindingEngine::instance();
+        const auto tracking = engine.tracking;
+        notified            = ++engine.stamp;
+        if (!tracking)
+            ++engine.epoch_;
+        engine.tracking   = nullptr;
+        engine.delivering = value ? this : nullptr;
+        engine.payload_   = value;
+        for (const auto binding : impl::as_const(bindings))
+            binding->notify();
+        engine.flush();
+
+        // A nested notification may have changed the value since, later reads go through the getter
+        engine.delivering = nullptr;
+        engine.tracking   = tracking;
+    }
+
+private:
+    BindingObject*          owner;
+    BindingKey              key;
+    Binding*                writer  = nullptr; // Writing a source outside of any QObject, the first one if several
+    int                     writers = 0;
+    QVector<Binding*>       bindings;
+    QVector<int>            bindingSlots; // Position of the source in the sources of each binding
+    int                     rank = 0; // Rank of the binding writing this property
+    quint64                 mark     = 0; // Stamp of the last evaluation or tracking pass which saw the source
+    quint64                 notified = 0; // Stamp of the last notification
+    quint64                 readAt   = 0; // Stamp of the last first read by an evaluation
+    QMetaObject::Connection connection;
+    std::shared_ptr<Relay>  relay; // Of a property of another thread
+
+    std::unique_ptr<ChangeFilter> filter;
+    ChangeFilter* (*makeFilter)(QObject*) = nullptr; // Null for types without operator==
+
+    BindingSource(BindingObject* owner, BindingKey key)
+        : owner(owner)
+        , key(key)
+    {
+    }
+};
+
+BindingObject::~BindingObject()
+{
+    if (cullViewport)
+        --engine->viewports;
+    if (suspended)
+        --engine->suspensions;
+    if (deferHidden)
+        --engine->deferRoots;
+    for (const auto& connection : impl::as_const(scrolling))
+        QObject::disconnect(connection);
+    for (const auto binding : impl::as_const(stale))
+        binding->holder = nullptr;
+    stale.clear();
+
+    // Torn down in one pass, each binding is detached from the object before it is deleted, so no list of the object is
+    // searched once per binding: sources first detach their readers, then the readers forget the object
+    for (const auto source : impl::as_const(sources))
+        delete source;
+    sources.clear();
+    events.clear();
+    notifiers.clear();
+
+    while (!watchers.isEmpty()) {
+        const auto binding = watchers.last();
+        binding->unwatch(watcherSlots.last());
+        binding->release();
+    }
+
+    while (!bindings.isEmpty())
+        delete *bindings.begin();
+}
+
+void BindingObject::setDeferHidden(bool enable)
+{
+    if (deferHidden == enable)
+        return;
+    deferHidden = enable;
+    engine->deferRoots += enable ? 1 : -1;
+    if (enable)
+        return;
+
+    // Hidden targets hold their own bindings, those of the subtree catch up once, or are held again by another root
+    QVector<QPointer<QObject>> holders;
+    for (const auto data : impl::as_const(engine->objects)) {
+        if (data->stale.isEmpty() || data->dead || !data->object->isWidgetType())
+            continue;
+        for (auto widget = static_cast<QWidget*>(data->object); widget; widget = widget->parentWidget()) {
+            if (widget == object) {
+                holders.append(data->object);
+                break;
+            }
+        }
+    }
+
+    engine->begin();
+    for (const auto& holder : impl::as_const(holders))
+        if (const auto data = holder ? find(holder) : nullptr)
+            data->reveal();
+    engine->commit();
+}
+
+void BindingObject::setCullViewport(QAbstractScrollArea* area, bool enable)
+{
+    if (cullViewport == enable)
+        return;
+    cullViewport = enable;
+
+    auto& engine = BindingEngine::instance();
+    if (enable) {
+        ++engine.viewports;
+        object->installEventFilter(&engine.filter);
+        const auto viewport = object;
+        const auto scrolled = [viewport]()
+        {
+            if (const auto data = find(viewport))
+                data->reveal();
+        };
+        scrolling.append(QObject::connect(area->horizontalScrollBar(), &QScrollBar::valueChanged, scrolled));
+        scrolling.append(QObject::connect(area->verticalScrollBar(), &QScrollBar::valueChanged, scrolled));
+    } else {
+        --engine.viewports;
+        for (const auto& connection : impl::as_const(scrolling))
+            QObject::disconnect(connection);
+        scrolling.clear();
+        reveal();
+    }
+}
+
+// Held bindings of the subtree catch up once, those still culled are held again by their current culler
+void BindingObject::setSuspended(bool enable)
+{
+    if (suspended == enable)
+        return;
+    suspended = enable;
+
+    auto& engine = BindingEngine::instance();
+    if (enable) {
+        ++engine.suspensions;
+    } else {
+        --engine.suspensions;
+        reveal();
+    }
+}
+
+// Binding data holding the bindings targeting the object while they would be wasted, nullptr if they are not
+BindingObject* BindingObject::culler()
+{
+    if (!object->isWidgetType())
+        return nullptr;
+
+    // Only walks the ancestors when some root could hold the binding
+    const auto target  = static_cast<QWidget*>(object);
+    const bool visible = target->isVisible();
+    if (engine->suspensions == 0 && (visible ? engine->viewports == 0 : engine->deferRoots == 0))
+        return nullptr;
+
+    for (auto widget = target; widget; widget = widget->parentWidget()) {
+        const auto data = find(widget);
+        if (!data)
+            continue;
+        if (data->suspended)
+            return data;
+        if (!visible && data->deferHidden)
+            return this;
+        if (visible && data->cullViewport && widget != target
+            && !QRect(target->mapTo(widget, QPoint()), target->size()).intersects(widget->rect()))
+            return data;
+    }
+    return nullptr;
+}
+
+void BindingObject::hold(Binding* binding)
+{
+    if (binding->holder)
+        return;
+    binding->holder = this;
+    if (stale.isEmpty())
+        object->installEventFilter(&BindingEngine::instance().filter);
+    stale.append(binding);
+}
+
+// Notifies the held bindings again, those still culled are held again by their current culler
+void BindingObject::reveal()
+{
+    auto& engine = BindingEngine::instance();
+    if (!cullViewport && events.isEmpty())
+        object->removeEventFilter(&engine.filter);
+
+    QVector<Binding*> bindings;
+    bindings.swap(stale);
+    for (const auto binding : impl::as_const(bindings)) {
+        binding->holder = nullptr;
+        binding->notify();
+    }
+    engine.flush();
+}
+
+bool BindingFilter::eventFilter(QObject* obj, QEvent* event)
+{
+    const auto data = BindingObject::find(obj);
+    if (!data)
+        return false;
+    if ((event->type() == QEvent::Show || event->type() == QEvent::Resize) && !data->stale.isEmpty()
+        && !data->suspended)
+        data->reveal();
+    if (!data->events.isEmpty())
+        data->notifyEvent(event);
+    return false;
+}
+
+void BindingObject::notifyEvent(QEvent* event)
+{
+    const auto sources = events.value(event->type());
+    if (sources.isEmpty())
+        return;
+
+    auto& engine = BindingEngine::instance();
+    engine.begin();
+    for (const auto source : sources)
+        source->notify();
+    engine.commit();
+}
+
+template <typename Prop> BindingSource* BindingObject::source(Prop prop)
+{
+    const auto key = bindingKey<typename Prop::Info>();
+
+    auto& source = sources[key];
+    if (source)
+        return source;
+
+    source = new BindingSource(this, key);
+    if (auto writer = findBinding(key))
+        source->rank = writer->rank();
+    observe(source, prop, std::integral_constant<bool, Prop::hasNotifySignal>{});
+    return source;
+}
+
+// The argument of a notify signal is the new value when it has the type of the property
+template <typename Prop, typename Sink>
+QMetaObject::Connection BindingObject::connectNotify(Prop prop, Sink sink, std::true_type)
+{
+    return QObject::connect(prop.object(),
+                            Prop::notify(),
+                            [sink](const typename Prop::Type& value) { sink(&value); });
+}
+
+template <typename Prop, typename Sink>
+QMetaObject::Connection BindingObject::connectNotify(Prop prop, Sink sink, std::false_type)
+{
+    return QObject::connect(prop.object(), Prop::notify(), [sink]() { sink(nullptr); });
+}
+
+template <typename Prop> void BindingObject::observe(BindingSource* source, Prop prop, std::true_type)
+{
+    const auto payload = std::is_same<notify_arg_t<decltype(Prop::notify())>, std::decay_t<typename Prop::Type>>{};
+
+    // Runs in the thread of the property, which never touches the bindings of this one
+    if (object->thread() != QThread::currentThread()) {
+        const auto relay   = std::make_shared<Relay>(new MailboxOf<Prop>(prop), source, engine);
+        const auto deliver = [relay](const void* value)
+        {
+            relay->mailbox->publish(value);
+            if (!relay->posted.exchange(true))
+                relay->engine->post(relay);
+        };
+        source->relay      = relay;
+        source->connection = connectNotify(prop, deliver, payload);
+
+        // The getter is only called in the thread of the property, dropped with the object
+        QMetaObject::invokeMethod(object, [deliver]() { deliver(nullptr); }, Qt::QueuedConnection);
+        return;
+    }
+
+    source->connection = connectNotify(prop, [source](const void* value) { source->signaled(value); }, payload);
+
+    if (equality_cutoff<typename Prop::Type>::value)
+        source->makeFilter = &ChangeFilterOf<Prop>::make;
+
+    // Coarse signals, as QAction::changed, notify several properties. A signal shared by properties declared by nwidget
+    // only is found once two of them are observed
+    const int signal = QMetaMethod::fromSignal(Prop::notify()).methodIndex();
+    auto&     shared = notifiers[signal];
+    shared.append(source);
+    if (shared.size() < 2 && !isSharedNotify(object->metaObject(), signal))
+        return;
+    for (const auto notified : impl::as_const(shared)) {
+        if (!notified->filter && notified->makeFilter)
+            notified->filter.reset(notified->makeFilter(object));
+    }
+}
+
+// Properties without a notify signal are notified by the events changing them, through the filter of the thread
+template <typename Prop> void BindingObject::observe(BindingSource* source, Prop, std::false_type)
+{
+    if (events.isEmpty())
+        object->installEventFilter(&BindingEngine::instance().filter);
+    for (const auto type : notifyEvents<Prop>())
+        events[type].append(source);
+}
+
+void BindingEngine::schedule(Binding* binding)
+{
+    if (binding->queued) {
+        ++skipped_;
+        return;
+    }
+    binding->queued     = true;
+    binding->queuedRank = binding->rank();
+
+    auto& rank          = queue[binding->queuedRank];
+    binding->queuedSlot = rank.bindings.size();
+    rank.bindings.append(binding);
+}
+
+void BindingEngine::defer(Binding* binding)
+{
+    if (binding->deferred) {
+        ++skipped_;
+        return;
+    }
+    binding->deferred     = true;
+    binding->deferredSlot = deferred.size();
+    deferred.append(binding);
+
+    // Posted at normal priority, so it is delivered before the low priority UpdateRequest of the next paint
+    if (!flushPosted) {
+        flushPosted = true;
+        QMetaObject::invokeMethod(&context, [this]() { flushDeferred(); }, Qt::QueuedConnection);
+    }
+}
+
+void BindingEngine::post(std::shared_ptr<Relay> relay)
+{
+    QMutexLocker locker(&mutex);
+    inbox.append(std::move(relay));
+
+    if (!inboxPosted) {
+        inboxPosted = true;
+        QMetaObject::invokeMethod(&context, [this]() { flushInbox(); }, Qt::QueuedConnection);
+    }
+}
+
+void BindingEngine::cancel(Binding* binding)
+{
+    if (binding->pending) {
+        binding->pending              = false;
+        pending[binding->pendingSlot] = nullptr;
+    }
+    if (binding->deferred) {
+        binding->deferred               = false;
+        deferred[binding->deferredSlot] = nullptr;
+    }
+    if (!binding->queued)
+        return;
+    binding->queued = false;
+    auto it         = queue.find(binding->queuedRank);
+    if (it != queue.end())
+        it->bindings[binding->queuedSlot] = nullptr;
+}
+
+void BindingEngine::flush()
+{
+    if (flushing || depth > 0)
+        return;
+    flushing = true;
+    while (!queue.isEmpty()) {
+        auto it = queue.begin();
+        if (it->next == it->bindings.size()) {
+            queue.erase(it);
+            continue;
+        }
+        const auto binding = it->bindings.at(it->next++);
+        if (!binding) // Cancelled
+            continue;
+        binding->queued = false;
+#if N_BINDING_CYCLE_LIMIT > 0
+        // Counted across flushes, so a cycle through queued or deferred bindings is caught as well
+        if (binding->runEpoch != epoch_) {
+            binding->runEpoch = epoch_;
+            binding->runs     = 0;
+        }
+        if (++binding->runs > N_BINDING_CYCLE_LIMIT) {
+            reportCycle(binding);
+            break;
+        }
+#endif
+        binding->run();
+    }
+    flushing = false;
+}
+
+void BindingEngine::reportCycle(Binding* binding)
+{
+    QStringList path;
+    for (const auto b : binding->cycle())
+        path.append(b->describe());
+    path.append(binding->describe());
+    qWarning("nwidget: binding cycle %s, propagation stopped", qPrintable(path.join(QStringLiteral(" -> "))));
+
+    // Drops the propagation rather than spinning, entries before next are already taken
+    for (const auto& rank : impl::as_const(queue))
+        for (int i = rank.next; i < rank.bindings.size(); ++i)
+            if (const auto b = rank.bindings.at(i))
+                b->queued = false;
+    queue.clear();
+}
+
+void BindingEngine::read(BindingSource* source)
+{
+    // Pulls the writer of a property read before its first evaluation
+    if (!pending.isEmpty())
+        pull(source->owner ? source->owner->findBinding(source->key) : source->writer);
+
+    if (tracking && source->mark != tracking->stamp) {
+        source->mark   = tracking->stamp;
+        source->readAt = ++stamp;
+        tracking->reading.append(source);
+    }
+}
+
+void BindingEngine::pull(Binding* binding)
+{
+    if (binding && binding->pending) {
+        binding->pending              = false;
+        pending[binding->pendingSlot] = nullptr;
+        binding->refresh();
+    }
+}
+
+void BindingEngine::endConstruction()
+{
+    if (--constructing > 0)
+        return;
+
+    // In creation order, a construction opened by a refresh drains the rest itself
+    begin();
+    while (pendingNext < pending.size()) {
+        const auto binding = pending.at(pendingNext++);
+        if (!binding) // Pulled or cancelled
+            continue;
+        binding->pending = false;
+        binding->refresh();
+    }
+    pending.clear();
+    pendingNext = 0;
+    commit();
+}
+
+void BindingEngine::flushDeferred()
+{
+    flushPosted = false;
+    for (const auto binding : impl::as_const(deferred)) {
+        if (!binding) // Cancelled
+            continue;
+        binding->deferred = false;
+        schedule(binding);
+    }
+    deferred.clear();
+    flush();
+}
+
+// Objects outliving the thread keep their data, which is no longer notified
+BindingEngine::~BindingEngine()
+{
+    for (const auto data : impl::as_const(objects)) {
+        QObject::disconnect(data->destroyed);
+        for (const auto source : impl::as_const(data->sources))
+            QObject::disconnect(source->connection);
+    }
+}
+
+void BindingEngine::drop(BindingObject* data)
+{
+    const auto it = objects.find(data->object);
+    if (it != objects.end() && *it == data)
+        objects.erase(it);
+    delete data;
+}
+
+// A value published once the relay is taken posts it again, so the latest one is never left unread
+void BindingEngine::flushInbox()
+{
+    QVector<std::shared_ptr<Relay>> relays;
+    {
+        QMutexLocker locker(&mutex);
+        inboxPosted = false;
+        relays.swap(inbox);
+    }
+    begin();
+    for (const auto& relay : impl::as_const(relays)) {
+        relay->posted = false;
+        if (relay->source)
+            relay->source->notify();
+    }
+    commit();
+}
+
+Binding::~Binding()
+{
+    engine->cancel(this);
+    reset();
+    if (owner)
+        owner->bindings.remove(key);
+    if (holder)
+        holder->stale.removeOne(this);
+    if (target) {
+        --target->writers;
+        if (target->writer == this)
+            target->writer = nullptr;
+    }
+    resetHandles();
+}
+
+void Binding::setTarget(BindingSource* source)
+{
+    target = source;
+    if (!source->writer)
+        source->writer = this;
+    ++source->writers;
+    updateRank();
+}
+
+void Binding::release()
+{
+    if (!owned) {
+        delete this;
+        return;
+    }
+    engine->cancel(this);
+    reset();
+    func = nullptr;
+}
+
+void Binding::run()
+{
+    if (!func) // Released
+        return;
+    for (const auto data : impl::as_const(watched))
+        if (data->dead) // Deleted by the teardown of the object, its properties are not read anymore
+            return;
+
+    const auto tracking = engine->tracking;
+    engine->tracking    = this;
+    stamp               = ++engine->stamp;
+    cursor              = 0;
+    reading.clear();
+    func();
+    engine->tracking = tracking;
+    track();
+}
+
+void Binding::refresh()
+{
+    if (suspended) {
+        dirty = true;
+        return;
+    }
+    if (engine->constructing > 0) {
+        if (!pending) {
+            pending     = true;
+            pendingSlot = engine->pending.size();
+            engine->pending.append(this);
+        }
+        return;
+    }
+    if (const auto culler = owner ? owner->culler() : nullptr) {
+        culler->hold(this);
+        return;
+    }
+    run();
+    engine->flush(); // Evaluates it again if it missed a change
+}
+
+// Called in the thread of the engine only, changes of other threads come through their relay
+void Binding::notify()
+{
+    Q_ASSERT(engine == &BindingEngine::instance());
+    if (suspended) {
+        dirty = true;
+        return;
+    }
+    if (const auto culler = owner ? owner->culler() : nullptr) {
+        culler->hold(this);
+        return;
+    }
+
+    const auto connection = type & ~Qt::UniqueConnection;
+    if (connection == Qt::QueuedConnection || connection == Qt::BlockingQueuedConnection)
+        engine->defer(this);
+    else
+        engine->schedule(this);
+}
+
+void Binding::suspend()
+{
+    if (suspended)
+        return;
+    suspended = true;
+    if (queued || deferred || pending) {
+        dirty = true;
+        engine->cancel(this);
+    }
+}
+
+void Binding::resume()
+{
+    if (!suspended)
+        return;
+    suspended = false;
+    if (!dirty)
+        return;
+    dirty = false;
+    notify();
+    engine->flush();
+}
+
+void Binding::reset()
+{
+    while (!sources.isEmpty())
+        unsubscribe(sources.size() - 1);
+    while (!watched.isEmpty())
+        unwatch(watched.size() - 1);
+    leaves.clear();
+}
+
+void Binding::rebind()
+{
+    engine->cancel(this);
+    reset();
+    resetHandles();
+    suspended = false;
+    dirty     = false;
+}
+
+void Binding::subscribe(BindingSource* source)
+{
+    sources.append(source);
+    sourceSlots.append(source->bindings.size());
+    source->bindings.append(this);
+    source->bindingSlots.append(sources.size() - 1);
+}
+
+void Binding::unsubscribe(int i)
+{
+    const auto source = sources.at(i);
+    swapRemove(source->bindings, source->bindingSlots, sourceSlots.at(i), &Binding::sourceSlots);
+    swapRemove(sources, sourceSlots, i, &BindingSource::bindingSlots);
+}
+
+void Binding::unwatch(int i)
+{
+    const auto data = watched.at(i);
+    swapRemove(data->watchers, data->watcherSlots, watchedSlots.at(i), &Binding::watchedSlots);
+    swapRemove(watched, watchedSlots, i, &BindingObject::watcherSlots);
+}
+
+// Subscribes to the sources read by the last evaluation only, so untaken branches never wake the binding. Sources are
+// told apart by their mark: old ones are marked first, those read again are marked kept, which also drops repeated reads
+void Binding::track()
+{
+    const auto old  = ++engine->stamp;
+    const auto kept = ++engine->stamp;
+    for (const auto source : impl::as_const(sources))
+        source->mark = old;
+
+    // A source notified after it was read but before the binding listened to it was missed, e.g. by the first
+    // evaluation of a binding closing a cycle
+    bool changed = false;
+    bool missed  = false;
+    for (const auto source : impl::as_const(reading)) {
+        if (source->mark == kept)
+            continue;
+        if (source->mark != old) {
+            subscribe(source);
+            changed = true;
+            missed  = missed || source->notified > source->readAt;
+        }
+        source->mark = kept;
+    }
+    reading.clear();
+
+    // Backwards, the last source taking the place of a removed one is already visited
+    for (int i = sources.size() - 1; i >= 0; --i) {
+        if (sources.at(i)->mark == old) {
+            unsubscribe(i);
+            changed = true;
+        }
+    }
+
+    if (changed)
+        updateRank();
+    if (missed)
+        notify();
+}
+
+void Binding::updateRank()
+{
+    int rank = 0;
+    for (const auto source : impl::as_const(sources))
+        rank = qMax(rank, source->rank);
+    setRank(rank + 1);
+}
+
+// Depth first through the readers, with a stack of its own so a long chain of bindings cannot overflow the call stack
+void Binding::setRank(int rank)
+{
+    struct Frame
+    {
+        Binding*       binding;
+        BindingSource* source; // Written by the binding
+        int            next;   // Reader visited next
+    };
+    QVector<Frame> stack;
+
+    const auto enter = [&stack](Binding* binding, int rank)
+    {
+        if (binding->ranking) // Cycle, e.g. two bindings writing each other
+            return;
+        binding->rank_ = rank;
+
+        auto source = binding->target;
+        if (!source && binding->owner)
+            source = binding->owner->findSource(binding->key);
+        if (!source)
+            return;
+
+        // A source written by several bindings keeps the highest of their ranks
+        binding->ranking = true;
+        source->rank     = source->writers > 1 ? qMax(source->rank, rank) : rank;
+        stack.append({binding, source, 0});
+    };
+
+    enter(this, rank);
+    while (!stack.isEmpty()) {
+        auto& frame = stack.last();
+        if (frame.next == frame.source->bindings.size()) {
+            frame.binding->ranking = false;
+            stack.removeLast();
+            continue;
+        }
+        const auto reader = frame.source->bindings.at(frame.next++);
+        const int  next   = frame.binding->rank_ + 1;
+        if (reader->rank_ < next)
+            enter(reader, next);
+    }
+}
+
+QString Binding::describe() const
+{
+    const auto property = QString::fromLatin1(name ? name : "<function>");
+    if (!owner)
+        return property;
+    const auto obj = owner->object;
+    return QStringLiteral("%1(%2).%3")
+        .arg(QString::fromLatin1(obj->metaObject()->className()), obj->objectName(), property);
+}
+
+QVector<Binding*> Binding::cycle()
+{
+    QVector<Binding*> path{this};
+    QSet<Binding*>    visited;
+    return findCycle(path, visited) ? path : QVector<Binding*>();
+}
+
+// Depth first through the readers of the source written by the last binding of path
+bool Binding::findCycle(QVector<Binding*>& path, QSet<Binding*>& visited)
+{
+    const auto last   = path.last();
+    const auto source = last->target ? last->target : last->owner ? last->owner->findSource(last->key) : nullptr;
+    if (!source)
+        return false;
+    for (const auto binding : impl::as_const(source->bindings)) {
+        if (binding == this)
+            return true;
+        if (visited.contains(binding))
+            continue;
+        visited.insert(binding);
+        path.append(binding);
+        if (findCycle(path, visited))
+            return true;
+        path.removeLast();
+    }
+    return false;
+}
+
+template <typename Prop> BindingSource* Binding::leaf(Prop prop)
+{
+    const auto object = prop.object();
+    const auto key    = bindingKey<typename Prop::Info>();
+    if (cursor == leaves.size())
+        leaves.append({nullptr, nullptr, nullptr});
+
+    auto& leaf = leaves[cursor++];
+    if (leaf.object != object || leaf.key != key)
+        leaf = {object, key, BindingSource::get(prop)};
+    return leaf.source;
+}
+
+template <typename Prop> BindingSource* BindingEngine::source(Prop prop)
+{
+    return tracking ? tracking->leaf(prop) : BindingSource::get(prop);
+}
+
+} // namespace impl
+
+/**
+ * @brief Suspends binding propagation of the current thread while alive.
+ * @details
+ * Changed sources only mark their bindings dirty, each of them is evaluated once when the outermost transaction closes:
+ *      @code{.cpp}
+ *      {
+ *          Transaction transaction;
+ *          for (const auto& it : settings)
+ *              it.prop.set(it.value);
+ *      } // bindings depending on the properties are evaluated here
+ *      @endcode
+ */
+class Transaction
+{
+    N_DISABLE_COPY_MOVE(Transaction)
+
+public:
+    Transaction() : start(impl::BindingEngine::instance().skipped()) { impl::BindingEngine::instance().begin(); }
+    ~Transaction() { impl::BindingEngine::instance().commit(); }
+
+    // Evaluations saved since the transaction was opened
+    qint64 skipped() const { return impl::BindingEngine::instance().skipped() - start; }
+
+    template <typename Func> static void batch(Func func)
+    {
+        Transaction transaction;
+        func();
+    }
+
+private:
+    qint64 start;
+};
+
+/**
+ * @brief Handle of a binding created by bindTo, movable and reset once the binding is deleted.
+ * @details
+ * The handle does not own the binding, which is still deleted with its target or one of its sources. ScopedBinding
+ * unbinds it once out of scope:
+ *      @code{.cpp}
+ *      BindingHandle handle = (a.value() + b.value()).bindTo(c.value());
+ *      handle.suspend();
+ *      a.value() = 1;
+ *      b.value() = 2;
+ *      handle.resume(); // evaluated once here
+ *      handle.unbind();
+ *      @endcode
+ * A binding must not be unbound by its own evaluation. A binding targeting an object of another thread is created and
+ * evaluated in that thread, its handle is not bound.
+ */
+class BindingHandle
+{
+    friend class impl::Binding;
+
+public:
+    BindingHandle() = default;
+    explicit BindingHandle(impl::Binding* binding) { attach(binding); }
+
+    BindingHandle(const BindingHandle&)            = delete;
+    BindingHandle& operator=(const BindingHandle&) = delete;
+
+    BindingHandle(BindingHandle&& other) noexcept { take(other); }
+
+    BindingHandle& operator=(BindingHandle&& other) noexcept
+    {
+        if (this != &other) {
+            detach();
+            take(other);
+        }
+        return *this;
+    }
+
+    ~BindingHandle() { detach(); }
+
+    bool isBound() const { return binding; }
+    bool isSuspended() const { return binding && binding->suspended; }
+
+    void unbind() { delete binding; }
+
+    void suspend()
+    {
+        if (binding)
+            binding->suspend();
+    }
+
+    void resume()
+    {
+        if (binding)
+            binding->resume();
+    }
+
+private:
+    impl::Binding* binding = nullptr;
+    BindingHandle* prev    = nullptr; // Intrusive list of the handles of the binding
+    BindingHandle* next    = nullptr;
+
+    void attach(impl::Binding* target)
+    {
+        if (!target)
+            return;
+        binding = target;
+        next    = target->handles;
+        if (next)
+            next->prev = this;
+        target->handles = this;
+    }
+
+    void detach()
+    {
+        if (!binding)
+            return;
+        if (prev)
+            prev->next = next;
+        else
+            binding->handles = next;
+        if (next)
+            next->prev = prev;
+        binding = nullptr;
+        prev    = nullptr;
+        next    = nullptr;
+    }
+
+    void take(BindingHandle& other)
+    {
+        const auto target = other.binding;
+        other.detach();
+        attach(target);
+    }
+};
+
+// Unbinds its binding once destroyed
+class ScopedBinding : public BindingHandle
+{
+public:
+    ScopedBinding() = default;
+    ScopedBinding(BindingHandle&& handle) : BindingHandle(std::move(handle)) {}
+
+    ScopedBinding(ScopedBinding&&) = default;
+
+    ScopedBinding& operator=(ScopedBinding&& other) noexcept
+    {
+        unbind();
+        BindingHandle::operator=(std::move(other));
+        return *this;
+    }
+
+    ~ScopedBinding() { unbind(); }
+};
+
+namespace impl {
+
+void Binding::resetHandles()
+{
+    for (auto handle = handles; handle;) {
+        const auto next = handle->next;
+        handle->binding = nullptr;
+        handle->prev    = nullptr;
+        handle->next    = nullptr;
+        handle          = next;
+    }
+    handles = nullptr;
+}
+
+} // namespace impl
+
+/**
+ * @brief Defers the bindings targeting root or one of its descendants while their target is hidden.
+ * @details
+ * A hidden target only marks its bindings stale when a source changes, they are evaluated once when it receives
+ * QEvent::Show. Suits inactive QTabWidget pages, collapsed QToolBox sections or closed dialogs:
+ *      @code{.cpp}
+ *      deferWhileHidden(tabWidget);
+ *      label.text() = asprintf_("%d", feed.value()); // label on a tab page, updated while its page is current only
+ *      @endcode
+ */
+inline void deferWhileHidden(QWidget* root, bool enable = true)
+{
+    impl::BindingObject::get(root)->setDeferHidden(enable);
+}
+
+/**
+ * @brief Defers the bindings targeting descendants of the viewport of area while they are scrolled out of view.
+ * @details
+ * A binding whose target rect does not intersect the viewport only marks itself stale, it catches up once scrolling
+ * or resizing the viewport brings the target into view. Suits long forms and dashboards in a QScrollArea:
+ *      @code{.cpp}
+ *      cullOutsideViewport(scrollArea);
+ *      @endcode
+ */
+inline void cullOutsideViewport(QAbstractScrollArea* area, bool enable = true)
+{
+    impl::BindingObject::get(area->viewport())->setCullViewport(area, enable);
+}
+
+/**
+ * @brief cullOutsideViewport() on the scroll area of a builder, which is returned to go on with the chain.
+ * @details
+ *      @code{.cpp}
+ *      QTableView* view = cullBindings(TableView().showGrid(false));
+ *      @endcode
+ */
+template <typename B,
+          std::enable_if_t<std::is_base_of<QAbstractScrollArea, typename std::decay_t<B>::Class>::value, bool> = true>
+B&& cullBindings(B&& builder, bool enable = true)
+{
+    cullOutsideViewport(builder.object_(), enable);
+    return std::forward<B>(builder);
+}
+
+/**
+ * @brief Suspends the bindings targeting root or one of its descendants until resumeBindings(root).
+ * @details
+ * A suspended binding only records that it is dirty when a source changes, each of them is evaluated once when the
+ * subtree is resumed. Suits panels being rearranged or hidden behind a modal dialog:
+ *      @code{.cpp}
+ *      suspendBindings(panel);
+ *      rearrange(panel);
+ *      resumeBindings(panel); // catches up here
+ *      @endcode
+ */
+inline void suspendBindings(QWidget* root)
+{
+    impl::BindingObject::get(root)->setSuspended(true);
+}
+
+inline void resumeBindings(QWidget* root)
+{
+    if (const auto data = impl::BindingObject::find(root))
+        data->setSuspended(false);
+}
+
+/**
+ * @brief Notifies the bindings reading property when its object receives an event of type.
+ * @details
+ * Properties without a notify signal are observed through the events changing them, geometry, palette, font and a
+ * few others of QWidget are mapped by default. The mapping of a class applies to its subclasses, and to the properties
+ * observed afterwards. Call it in the main thread, before any other thread reads the property:
+ *      @code{.cpp}
+ *      notifyOnEvent<QWidget>("sizeHint", QEvent::LayoutRequest);
+ *      label.text() = asprintf_("%d", widget.width()); // updated on QEvent::Resize
+ *      @endcode
+ */
+template <typename Class> void notifyOnEvent(const char* property, QEvent::Type type)
+{
+    static_assert(std::is_base_of<QObject, Class>::value, "events are only delivered to QObject");
+    impl::eventNotifiers()[QByteArray(Class::staticMetaObject.className()) + "::" + property].append(type);
+    ++impl::eventNotifiersVersion();
+}
+
+/**
+ * @brief Records the bindings created in the current thread while alive, and evaluates them once it closes.
+ * @details
+ * Each binding is evaluated once, after the bindings writing the properties it reads, so building a large form costs
+ * a single pass instead of an evaluation and a setter call per bindTo:
+ *      @code{.cpp}
+ *      {
+ *          Construction construction;
+ *          label.text() = asprintf_("%d", slider.value());
+ *          slider.value() = spinBox.value();
+ *      } // spinBox -> slider -> label evaluated here
+ *      @endcode
+ *
+ * Combined with deferWhileHidden() on the window, the pass is further held until it is first shown.
+ */
+class Construction
+{
+    N_DISABLE_COPY_MOVE(Construction)
+
+public:
+    Construction() { impl::BindingEngine::instance().beginConstruction(); }
+    ~Construction() { impl::BindingEngine::instance().endConstruction(); }
+
+    template <typename Func> static auto build(Func func)
+    {
+        Construction construction;
+        return func();
+    }
+};
+
+/**
+ * @brief Number of values of prop overwritten before a binding in another thread read them.
+ * @details
+ * Grows when the thread of prop.object() publishes faster than the bindings reading it are evaluated.
+ */
+template <typename... T> qint64 overwrittenUpdates(MetaProperty<T...> prop)
+{
+    const auto data   = impl::BindingObject::find(prop.object());
+    const auto source = data ? data->findSource(impl::bindingKey<typename MetaProperty<T...>::Info>()) : nullptr;
+    const auto box    = source ? source->findMailbox() : nullptr;
+    return box ? box->overwritten() : 0;
+}
+
+// Total of overwrittenUpdates() over every property
+inline qint64 overwrittenUpdates() { return impl::Mailbox::total(); }
+
+template <typename Action = impl::ActionEmpty, // struct { auto operator()(Args&&...) const { return ... } }
+          typename... Args>
+BindingExpr<Action, std::decay_t<Args>...> makeBindingExpr(Args&&... args)
+{
+    return BindingExpr<Action, std::decay_t<Args>...>(std::forward<Args>(args)...);
+}
+
+namespace impl {
+template <typename T> class Lazy;
+} // namespace impl
+
+template <> class BindingExpr<>
+{
+    template <typename...> friend class BindingExpr;
+    template <typename> friend class impl::Lazy;
+    friend class impl::Binding;
+
+    template <typename T> static auto    eval(const T& val) { return val; }
+    template <typename... T> static auto eval(const BindingExpr<T...>& expr) { return expr.eval(); }
+    template <typename T> static auto    eval(const Computed<T>& computed) { return computed.eval(); }
+    template <typename T> static auto    eval(const Value<T>& value) { return value.eval(); }
+    template <typename... T> static auto eval(MetaProperty<T...> prop) { return read(prop, track(prop)); }
+
+    // Reads the argument of the notify signal being delivered, the getter otherwise
+    template <typename T, std::enable_if_t<T::hasNotifySignal, bool> = true>
+    static auto read(T prop, const impl::BindingSource* source)
+    {
+        if (prop.object()->thread() == QThread::currentThread()) {
+            const auto value = source ? impl::BindingEngine::instance().payload(source) : nullptr;
+            return value ? *static_cast<const typename T::Type*>(value) : prop.get();
+        }
+        // Untracked, as the getter called directly
+        const auto box = source ? static_cast<impl::MailboxOf<T>*>(source->findMailbox()) : nullptr;
+        return box ? box->read() : prop.get();
+    }
+
+    template <typename T, std::enable_if_t<!T::hasNotifySignal, bool> = true>
+    static auto read(T prop, const impl::BindingSource*)
+    {
+        return prop.get();
+    }
+
+    // Source read by the binding being evaluated, nullptr if none
+    template <typename T, std::enable_if_t<T::hasNotifySignal, bool> = true> static auto track(T prop)
+    {
+        auto& engine = impl::BindingEngine::instance();
+        if (!engine.isTracking())
+            return (impl::BindingSource*)nullptr;
+        const auto source = engine.source(prop);
+        engine.read(source);
+        return source;
+    }
+
+    template <typename T, std::enable_if_t<!T::hasNotifySignal, bool> = true> static auto track(T prop)
+    {
+        auto& engine = impl::BindingEngine::instance();
+        if (!engine.isTracking() || impl::notifyEvents<T>().isEmpty()
+            || prop.object()->thread() != QThread::currentThread())
+            return (impl::BindingSource*)nullptr;
+        const auto source = engine.source(prop);
+        engine.read(source);
+        return source;
+    }
+
+    template <typename T, std::enable_if_t<!impl::is_meta_property_v<T> && !impl::is_binding_expr_v<T>, bool> = true>
+    static void bind(impl::Binding*, T)
+    {
+    }
+
+    template <typename T, std::enable_if_t<std::is_base_of<QObject, T>::value, bool> = true>
+    static void bind(impl::Binding* binding, T* obj)
+    {
+        binding->watch(obj);
+    }
+
+    // Sources are subscribed while evaluating, only the objects of every branch are watched up front
+    template <typename T, std::enable_if_t<impl::is_meta_property_v<T>, bool> = true>
+    static void bind(impl::Binding* binding, T prop)
+    {
+        binding->watch(prop.object());
+    }
+
+    template <typename T, std::enable_if_t<impl::is_binding_expr_v<T>, bool> = true>
+    static void bind(impl::Binding* binding, const T& expr)
+    {
+        impl::for_each([binding](const auto& arg) { bind(binding, arg); }, expr.args);
+    }
+
+    // Nodes evaluating an inner expression in a binding of their own, their readers are deleted with its objects too
+    template <typename T>
+    static auto bind(impl::Binding* binding, const std::shared_ptr<T>& node) -> decltype(node->inner(), void())
+    {
+        bind(binding, node->inner());
+    }
+
+    // Whether a change of the value is notified, properties without a notify signal need an entry in eventNotifiers()
+    template <typename T> static bool observable(const T&) { return impl::is_observable_v<T>; }
+
+    template <typename... T> static bool observable(MetaProperty<T...>)
+    {
+        return MetaProperty<T...>::hasNotifySignal || !impl::notifyEvents<MetaProperty<T...>>().isEmpty();
+    }
+
+    template <typename... T> static bool observable(const BindingExpr<T...>& expr)
+    {
+        bool result = false;
+        impl::for_each([&result](const auto& arg) { result = result || observable(arg); }, expr.args);
+        return result;
+    }
+
+    // clang-format off
+    template <typename E, typename L,             typename F> static auto invoke(const E&  , L&  ,       const F& f) -> decltype(f(        ), void()) { f(); }
+    template <typename E, typename L,             typename F> static auto invoke(const E& e, L& l,       const F& f) -> decltype(f(e.eval()), void()) { auto v = e.eval(); if (l.changed(v)) f(std::move(v)); }
+    template <typename E, typename L, typename C, typename F> static auto invoke(const E&  , L&  , C* r, const F& f) -> decltype((r->*f)(        ), void()) { (r->*f)(); }
+    template <typename E, typename L, typename C, typename F> static auto invoke(const E& e, L& l, C* r, const F& f) -> decltype((r->*f)(e.eval()), void()) { auto v = e.eval(); if (l.changed(v)) (r->*f)(std::move(v)); }
+    // clang-format on
+};
+
+namespace impl {
+
+// Unevaluated argument of a LazyAction
+template <typename T> class Lazy
+{
+public:
+    explicit Lazy(const T& arg) : arg(arg) {}
+
+    auto operator()() const { return BindingExpr<>::eval(arg); }
+
+private:
+    const T& arg;
+};
+
+template <typename Expr> void Binding::watchAll(const Expr& expr)
+{
+    BindingExpr<>::bind(this, expr);
+}
+
+// Runs func in QThreadPool, QRunnable::create needs Qt 5.15
+class AsyncTask : public QRunnable
+{
+public:
+    explicit AsyncTask(std::function<void()> func) : func(std::move(func)) {}
+
+    void run() override { func(); }
+
+private:
+    std::function<void()> func;
+};
+
+/**
+ * @brief State of an async_() node, shared by the copies of the expression.
+ * @details
+ * Evaluating the node with new arguments submits a computation tagged with a new generation, a result arriving after a
+ * newer submission is stale and dropped. An accepted result notifies the bindings reading the node, which evaluate it
+ * again and get the result. Arguments without operator== are submitted on every evaluation but the one of each
+ * reader notified of a result. An exception thrown by the computation is reported in the thread of the node, which keeps
+ * its last result.
+ */
+template <typename R, typename F, typename... Values>
+class AsyncState
+    : public ObservableNode
+    , public std::enable_shared_from_this<AsyncState<R, F, Values...>>
+{
+    N_DISABLE_COPY_MOVE(AsyncState)
+
+    static constexpr bool comparable = fold<std::logical_and<bool>, std::true_type, has_equal<Values>...>::value;
+
+public:
+    explicit AsyncState(F fn) : fn(std::move(fn))
+    {
+        static_assert(std::is_default_constructible<R>::value,
+                      "async_() yields R{} until its first result, use async_or_() otherwise");
+    }
+
+    AsyncState(F fn, R placeholder)
+        : fn(std::move(fn))
+        , placeholder(std::make_unique<R>(std::move(placeholder)))
+    {
+    }
+
+    R eval(const Values&... values)
+    {
+        auto& engine = BindingEngine::instance();
+        if (engine.isTracking())
+            engine.read(&source);
+
+        // Each reader notified of a result takes it once, so readers never submit it again for one another
+        const bool delivered = engine.current() && awaiting.remove(engine.current());
+
+        auto       args = std::make_tuple(values...);
+        const bool same = delivered || (last && equal(*last, args, std::integral_constant<bool, comparable>{}));
+        if (!same)
+            submit(std::move(args));
+
+        if (!value || (computing && placeholder))
+            return initial(std::is_default_constructible<R>{});
+        return *value;
+    }
+
+private:
+    F                                      fn;
+    std::shared_ptr<const R>               value;       // Latest result, none until the first one
+    std::unique_ptr<R>                     placeholder; // Yielded while computing, and before the first result
+    std::unique_ptr<std::tuple<Values...>> last;        // Arguments of the latest submission
+    quint64                                generation = 0;
+    bool                                   computing  = false;
+    QSet<const Binding*>                   awaiting; // Notified of the latest result, not evaluated since
+    BindingSource                          source;
+
+    static bool equal(const std::tuple<Values...>& a, const std::tuple<Values...>& b, std::true_type)
+    {
+        return a == b;
+    }
+    static bool equal(const std::tuple<Values...>&, const std::tuple<Values...>&, std::false_type) { return false; }
+
+    R initial(std::true_type) const { return placeholder ? *placeholder : R{}; }
+    R initial(std::false_type) const { return *placeholder; } // Set by async_or_()
+
+    static void report(const std::exception_ptr& error)
+    {
+        try {
+            std::rethrow_exception(error);
+        } catch (const std::exception& e) {
+            qWarning("nwidget: async_() computation failed: %s", e.what());
+        } catch (...) {
+            qWarning("nwidget: async_() computation failed");
+        }
+    }
+
+    void submit(std::tuple<Values...> args)
+    {
+        last      = std::make_unique<std::tuple<Values...>>(args);
+        computing = true;
+
+        const auto                generation = ++this->generation;
+        std::weak_ptr<AsyncState> weak       = this->shared_from_this();
+        const auto                engine     = &BindingEngine::instance();
+        QThreadPool::globalInstance()->start(new AsyncTask(
+            [fn = fn, args = std::move(args), generation, weak, engine]()
+            {
+                // Thrown out of the pool, an exception would terminate the application
+                std::shared_ptr<const R> result;
+                std::exception_ptr       error;
+                try {
+                    result = std::make_shared<const R>(impl::apply(fn, args));
+                } catch (...) {
+                    error = std::current_exception();
+                }
+                engine->dispatch(
+                    [weak, generation, result, error]()
+                    {
+                        if (const auto state = weak.lock())
+                            state->deliver(generation, result, error);
+                    });
+            }));
+    }
+
+    void deliver(quint64 generation, std::shared_ptr<const R> result, const std::exception_ptr& error)
+    {
+        if (generation != this->generation) // Stale, a newer computation is running
+            return;
+        if (error)
+            report(error);
+        else
+            value = std::move(result);
+        computing = false;
+        awaiting.clear();
+        for (const auto binding : source.readers())
+            awaiting.insert(binding);
+        source.notify();
+    }
+};
+
+template <typename F, typename... Args> struct async_state
+{
+    template <typename Arg> using value_t = std::decay_t<typename BindingExpr<ActionEmpty, std::decay_t<Arg>>::Type>;
+
+    using result = std::decay_t<decltype(std::declval<const F&>()(std::declval<const value_t<Args>&>()...))>;
+    using type   = AsyncState<result, F, value_t<Args>...>;
+};
+
+class WheelTimer;
+
+/**
+ * @brief Single timer wheel of a thread, shared by every WheelTimer started in it.
+ * @details
+ * Timers are hashed into Levels wheels of Slots slots by the distance to their deadline, and cascade to the lower wheel
+ * once the distance fits it, so starting and stopping a timer is O(1) and a tick only visits the current slot. The
+ * wheel ticks every N_BINDING_TIMER_TICK ms while a timer is running.
+ */
+class TimerWheel : public QObject
+{
+    N_DISABLE_COPY_MOVE(TimerWheel)
+
+public:
+    static TimerWheel& instance()
+    {
+        static thread_local TimerWheel wheel;
+        return wheel;
+    }
+
+    inline void start(WheelTimer* timer, int ms);
+    inline void stop(WheelTimer* timer);
+
+protected:
+    inline void timerEvent(QTimerEvent* event) override;
+
+private:
+    static constexpr int Bits   = 6;
+    static constexpr int Slots  = 1 << Bits;
+    static constexpr int Levels = 4;
+
+    QVector<WheelTimer*> wheels[Levels][Slots];
+    QVector<WheelTimer*> firing; // Expired in the current tick, a stopped one leaves a null behind
+    QElapsedTimer        clock;
+    QBasicTimer          ticker;
+    qint64               now   = 0; // Ticks elapsed
+    int                  count = 0; // Running timers
+
+    TimerWheel() { clock.start(); }
+
+    inline void insert(WheelTimer* timer);
+    inline void tick();
+};
+
+class WheelTimer
+{
+    N_DISABLE_COPY_MOVE(WheelTimer)
+
+    friend class TimerWheel;
+
+public:
+    WheelTimer() = default;
+    virtual ~WheelTimer() { stop(); }
+
+    bool isActive() const { return wheel; }
+
+    void start(int ms) { TimerWheel::instance().start(this, ms); }
+    void stop()
+    {
+        if (wheel)
+            wheel->stop(this);
+    }
+
+protected:
+    virtual void timeout() = 0;
+
+private:
+    TimerWheel* wheel = nullptr;
+    qint64      due   = 0;
+    int         level = 0; // -1 once expired
+    int         slot  = 0;
+    int         index = 0; // In its slot, or in the expired timers
+};
+
+void TimerWheel::start(WheelTimer* timer, int ms)
+{
+    if (timer->wheel)
+        stop(timer);
+    if (count++ == 0) {
+        now = clock.elapsed() / N_BINDING_TIMER_TICK;
+        ticker.start(N_BINDING_TIMER_TICK, Qt::PreciseTimer, this);
+    }
+    timer->wheel = this;
+    timer->due   = now + qMax(1, (ms + N_BINDING_TIMER_TICK - 1) / N_BINDING_TIMER_TICK);
+    insert(timer);
+}
+
+void TimerWheel::stop(WheelTimer* timer)
+{
+    if (timer->level < 0) {
+        firing[timer->index] = nullptr;
+    } else {
+        // The last timer of the slot takes the place of the stopped one
+        auto&      slot    = wheels[timer->level][timer->slot];
+        const auto last    = slot.last();
+        last->index        = timer->index;
+        slot[timer->index] = last;
+        slot.removeLast();
+    }
+    timer->wheel = nullptr;
+    if (--count == 0)
+        ticker.stop();
+}
+
+void TimerWheel::insert(WheelTimer* timer)
+{
+    const qint64 max   = (qint64(1) << (Bits * Levels)) - 1;
+    const qint64 delta = qMin(timer->due - now, max);
+    const qint64 due   = now + delta;
+
+    int level = 0;
+    while (level < Levels - 1 && delta >= (qint64(1) << (Bits * (level + 1))))
+        ++level;
+    timer->level = level;
+    timer->slot  = (due >> (Bits * level)) & (Slots - 1);
+    auto& slot   = wheels[level][timer->slot];
+    timer->index = slot.size();
+    slot.append(timer);
+}
+
+void TimerWheel::tick()
+{
+    ++now;
+
+    // Cascades the upper wheels whose current slot starts now, the highest first
+    int top = 0;
+    while (top < Levels - 1 && (now & ((qint64(1) << (Bits * (top + 1))) - 1)) == 0)
+        ++top;
+    for (int level = top; level > 0; --level) {
+        QVector<WheelTimer*> timers;
+        timers.swap(wheels[level][(now >> (Bits * level)) & (Slots - 1)]);
+        for (const auto timer : impl::as_const(timers))
+            insert(timer);
+    }
+
+    // A timeout may restart, stop or delete a timer expiring in the same tick, which nulls it in firing
+    firing.swap(wheels[0][now & (Slots - 1)]);
+    for (const auto timer : impl::as_const(firing))
+        timer->level = -1;
+    for (int i = 0; i < firing.size(); ++i) {
+        const auto timer = firing.at(i);
+        if (!timer)
+            continue;
+        timer->wheel = nullptr;
+        --count;
+        timer->timeout();
+    }
+    firing.clear();
+    if (count == 0)
+        ticker.stop();
+}
+
+void TimerWheel::timerEvent(QTimerEvent* event)
+{
+    if (event->timerId() != ticker.timerId())
+        return QObject::timerEvent(event);
+
+    const qint64 target = clock.elapsed() / N_BINDING_TIMER_TICK;
+    while (count > 0 && now < target)
+        tick();
+}
+
+/**
+ * @brief State of a throttle(), debounce() or sample() node.
+ * @details
+ * The inner expression is evaluated by a binding of its own, so its changes only reach the bindings reading the node
+ * when the node lets them through.
+ */
+template <typename Expr> class TimedState
+    : public ObservableNode
+    , public WheelTimer
+{
+    using T = std::decay_t<typename Expr::Type>;
+
+public:
+    enum Mode
+    {
+        Throttle, // Leading and trailing value of each window of ms
+        Debounce, // Value stable for ms
+        Sample,   // Latest value every ms, while it changes
+    };
+
+    TimedState(const Expr& expr, int ms, Mode mode)
+        : expr(expr)
+        , ms(ms)
+        , mode(mode)
+    {
+        binding.setOwned();
+        binding.setTarget(&source);
+        binding.watchAll(expr);
+        binding.setFunc([this]() { input(this->expr.eval()); }, Qt::AutoConnection);
+        binding.refresh();
+    }
+
+    const Expr& inner() const { return expr; }
+
+    T eval()
+    {
+        auto& engine = BindingEngine::instance();
+        if (engine.isTracking())
+            engine.read(&source);
+        return value;
+    }
+
+protected:
+    void timeout() override
+    {
+        if (!dirty)
+            return;
+        dirty = false;
+        publish(latest);
+        if (mode != Debounce)
+            start(ms);
+    }
+
+private:
+    Expr          expr;
+    int           ms;
+    Mode          mode;
+    T             value{};
+    T             latest{};
+    bool          dirty = false;
+    bool          first = true;
+    BindingSource source;
+    Binding       binding{nullptr, nullptr}; // Evaluates expr
+
+    void input(T val)
+    {
+        if (first || (mode == Throttle && !isActive())) {
+            // The initial value opens no window, so the first change is yielded at once
+            if (mode == Throttle && !first)
+                start(ms);
+            first = false;
+            publish(std::move(val));
+            return;
+        }
+
+        latest = std::move(val);
+        dirty  = true;
+        if (mode == Debounce || !isActive())
+            start(ms);
+    }
+
+    void publish(T val)
+    {
+        value = std::move(val);
+        source.notify();
+    }
+};
+
+// Folds of aggregate nodes, adding and removing a value in O(1) or O(log n)
+template <typename T> struct FoldSum
+{
+    T total{};
+
+    void add(const T& v) { total += v; }
+    void remove(const T& v) { total -= v; }
+    T    result(int) const { return total; }
+};
+
+template <typename T, typename Compare> struct FoldExtremum
+{
+    std::multiset<T, Compare> values;
+
+    void add(const T& v) { values.insert(v); }
+    void remove(const T& v) { values.erase(values.find(v)); }
+    T    result(int) const { return values.empty() ? T{} : *values.begin(); }
+};
+
+template <typename T, typename Pred> struct FoldCount
+{
+    Pred pred;
+    int  count = 0;
+
+    explicit FoldCount(Pred pred) : pred(std::move(pred)) {}
+
+    void add(const T& v) { count += bool(pred(v)); }
+    void remove(const T& v) { count -= bool(pred(v)); }
+    int  result(int) const { return count; }
+};
 
-#include <QSignalMapper>
+template <typename T, typename Pred> struct FoldAny : FoldCount<T, Pred>
+{
+    using FoldCount<T, Pred>::FoldCount;
 
-namespace nwidget {
+    bool result(int) const { return this->count > 0; }
+};
 
-namespace impl {
+template <typename T, typename Pred> struct FoldAll : FoldCount<T, Pred>
+{
+    using FoldCount<T, Pred>::FoldCount;
 
-struct ActionEmpty
+    bool result(int size) const { return this->count == size; }
+};
+
+struct Truthy
 {
-    template <typename T> auto operator()(T&& val) const { return val; }
+    template <typename T> bool operator()(const T& v) const { return bool(v); }
 };
 
-// clang-format off
+/**
+ * @brief State of an aggregate node over a runtime collection of properties.
+ * @details
+ * Each property is read by a binding of its own, a change removes the previous value of the property from the fold and
+ * adds the new one instead of folding the whole collection again. A destroyed property leaves the fold. The node is
+ * ranked after the bindings of all its properties, so its readers never see a partial fold.
+ */
+template <typename Prop, typename Fold> class AggregateState : public ObservableNode
+{
+    N_DISABLE_COPY_MOVE(AggregateState)
 
-template <typename ...T> struct is_observable;
+    using T = std::decay_t<typename Prop::Type>;
 
-template <typename T> constexpr bool is_observable_v = is_observable<T>::value;
+public:
+    template <typename Container> AggregateState(const Container& props, Fold fold) : fold(std::move(fold))
+    {
+        for (const auto& prop : props)
+            elements.emplace_back(new Element{prop, {}, {}, {}});
+
+        for (const auto& element : elements) {
+            const auto e = element.get();
+            e->destroyed = QObject::connect(e->prop.object(), &QObject::destroyed, [this, e]() { remove(e); });
+            e->binding.reset(new Binding(nullptr, nullptr));
+            e->binding->setTarget(&source);
+            e->binding->setFunc([this, e]() { update(e, makeBindingExpr(e->prop).eval()); }, Qt::AutoConnection);
+            e->binding->refresh();
+        }
+    }
 
-template <typename T> struct is_observable<T>
-    : std::false_type {};
+    ~AggregateState()
+    {
+        for (const auto& element : elements)
+            QObject::disconnect(element->destroyed);
+    }
 
-template <typename ...T> struct is_observable<MetaProperty<T...>>
-    : std::integral_constant<bool, MetaProperty<T...>::hasNotifySignal> {};
+    auto eval()
+    {
+        // Inside a construction the elements not evaluated yet are folded first
+        auto& engine = BindingEngine::instance();
+        if (engine.hasPending())
+            for (const auto& element : elements)
+                engine.pull(element->binding.get());
+        if (engine.isTracking())
+            engine.read(&source);
+        return fold.result(size);
+    }
 
-template <typename Action, typename... Args> struct is_observable<BindingExpr<Action, Args...>>
-    : std::integral_constant<bool, impl::fold<std::logical_or<bool>, std::false_type, is_observable<Args>...>::value> {};
+private:
+    struct Element
+    {
+        Prop                     prop;
+        std::unique_ptr<T>       value; // Added to the fold
+        std::unique_ptr<Binding> binding;
+        QMetaObject::Connection  destroyed;
+    };
+
+    Fold                                  fold;
+    int                                   size = 0;
+    BindingSource                         source;   // Written by the bindings of the elements
+    std::vector<std::unique_ptr<Element>> elements; // Destroyed before source
+
+    void update(Element* e, T v)
+    {
+        if (e->value) {
+            fold.remove(*e->value);
+            *e->value = std::move(v);
+        } else {
+            e->value.reset(new T(std::move(v)));
+            ++size;
+        }
+        fold.add(*e->value);
+        source.notify();
+    }
 
-template<typename T> struct is_meta_property : std::false_type {};
-template<typename T> constexpr bool is_meta_property_v = is_meta_property<T>::value;
-template<typename... T> struct is_meta_property<MetaProperty<T...>> : std::true_type {};
+    void remove(Element* e)
+    {
+        e->binding.reset();
+        if (!e->value)
+            return;
+        fold.remove(*e->value);
+        e->value.reset();
+        --size;
+        source.notify();
+    }
+};
 
-template<typename T> struct is_binding_expr : std::false_type {};
-template<typename T> constexpr bool is_binding_expr_v = is_binding_expr<T>::value;
-template<typename... T> struct is_binding_expr<BindingExpr<T...>> : std::true_type {};
+// Caches the value of an expression, evaluated once per propagation whatever the number of its readers
+template <typename T> class ComputedState : public ObservableNode
+{
+public:
+    template <typename Expr> explicit ComputedState(const Expr& expr)
+    {
+        binding.setOwned();
+        binding.setTarget(&source);
+        binding.watchAll(expr);
+        binding.setFunc(
+            [this, expr, last = Cutoff<T>()]() mutable
+            {
+                T val = expr.eval();
+                if (!last.changed(val))
+                    return;
+                value = std::move(val);
+                source.notify();
+            },
+            Qt::AutoConnection);
+        binding.refresh();
+    }
 
-// clang-format on
+    T eval()
+    {
+        auto& engine = BindingEngine::instance();
+        if (engine.isTracking())
+            engine.read(&source);
+        return value;
+    }
 
-} // namespace impl
+private:
+    T             value{};
+    BindingSource source;
+    Binding       binding{nullptr, nullptr}; // Evaluates the expression
+};
 
-template <typename Action = impl::ActionEmpty, // struct { auto operator()(Args&&...) const { return ... } }
-          typename... Args>
-BindingExpr<Action, std::decay_t<Args>...> makeBindingExpr(Args&&... args)
+// Value cell, its source is the list of the bindings reading it
+template <typename T> class ValueState : public ObservableNode
 {
-    return BindingExpr<Action, std::decay_t<Args>...>(std::forward<Args>(args)...);
-}
+public:
+    explicit ValueState(T value) : value(std::move(value)) {}
 
-template <> class BindingExpr<>
-{
-    template <typename...> friend class BindingExpr;
+    T eval()
+    {
+        auto& engine = BindingEngine::instance();
+        if (engine.isTracking())
+            engine.read(&source);
+        return value;
+    }
 
-    template <typename T> static auto    eval(const T& val) { return val; }
-    template <typename... T> static auto eval(const BindingExpr<T...>& expr) { return expr.eval(); }
-    template <typename... T> static auto eval(MetaProperty<T...> prop) { return prop.get(); }
+    void set(T val)
+    {
+        if (equal(value, val, equality_cutoff<T>{}))
+            return;
+        value = std::move(val);
+        source.notify();
+    }
 
-    template <typename T, std::enable_if_t<!impl::is_meta_property_v<T> && !impl::is_binding_expr_v<T>, bool> = true>
-    static void bind(QSignalMapper* binding, T)
+private:
+    T             value;
+    BindingSource source;
+
+    static bool equal(const T& a, const T& b, std::true_type) { return a == b; }
+    static bool equal(const T&, const T&, std::false_type) { return false; }
+};
+
+struct ActionNode
+{
+    template <typename S, typename... Args> auto operator()(const S& state, const Args&... args) const
     {
+        return state->eval(args...);
     }
+};
 
-    template <typename T, std::enable_if_t<std::is_base_of<QObject, T>::value, bool> = true>
-    static void bind(QSignalMapper* binding, T* obj)
+// Hits and misses of every memo_() node
+struct MemoTotals
+{
+    static std::atomic<qint64>& hits()
     {
-        QObject::connect(obj, &QObject::destroyed, binding, [binding]() { delete binding; });
+        static std::atomic<qint64> total{0};
+        return total;
     }
 
-    template <typename T, std::enable_if_t<impl::is_meta_property_v<T> && T::hasNotifySignal, bool> = true>
-    static void bind(QSignalMapper* binding, T prop)
+    static std::atomic<qint64>& misses()
     {
-        auto obj = prop.object();
-        QObject::connect(obj, &QObject::destroyed, binding, [binding]() { delete binding; });
-        QObject::connect(obj, T::notify(), binding, qOverload<>(&QSignalMapper::map), Qt::UniqueConnection);
-        binding->setMapping(obj, 0);
+        static std::atomic<qint64> total{0};
+        return total;
     }
+};
 
-    template <typename T, std::enable_if_t<impl::is_meta_property_v<T> && !T::hasNotifySignal, bool> = true>
-    static void bind(QSignalMapper* binding, T prop)
+// Part of the key of a memo_() node contributed by an argument, constants as the function of invoke() contribute none
+template <typename Arg, bool = is_meta_property_v<Arg> || is_binding_expr_v<Arg>> struct MemoKey
+{
+    template <typename V> static std::tuple<V> make(const V& value)
     {
-        QObject::connect(prop.object(), &QObject::destroyed, binding, [binding]() { delete binding; });
+        static_assert(is_cutoff_arg<V>::value,
+                      "memo_ needs arguments comparable with operator== and no pointers to objects");
+        return std::tuple<V>(value);
     }
+};
 
-    template <typename T, std::enable_if_t<impl::is_binding_expr_v<T>, bool> = true>
-    static void bind(QSignalMapper* binding, const T& expr)
+template <typename Arg> struct MemoKey<Arg, false>
+{
+    template <typename V> static std::tuple<> make(const V&) { return {}; }
+};
+
+/**
+ * @brief State of a memo_() node, the least recently used results of a node, shared by the copies of the expression.
+ * @details
+ * Keys are compared with operator== by a linear scan, which suits the few entries it is meant for. A hit is moved to
+ * the front of the list without copying its result. An invoke() node keeps its last result in a state of capacity 1.
+ */
+template <typename Action, std::size_t N, typename... Args> class MemoState
+{
+    N_DISABLE_COPY_MOVE(MemoState)
+
+    template <typename Arg> using value_t = std::decay_t<typename BindingExpr<ActionEmpty, Arg>::Type>;
+
+    using Result = std::decay_t<typename BindingExpr<Action, Args...>::Type>;
+    using Key    = decltype(std::tuple_cat(MemoKey<Args>::make(std::declval<const value_t<Args>&>())...));
+
+    static_assert(N > 0, "memo_ needs a capacity");
+    static_assert(!is_lazy_action<Action>::value && !std::is_void<Result>::value, "memo_ needs a node with a result");
+    static_assert(!std::is_same<Action, ActionNode>::value, "memo_ needs a node without a state of its own");
+
+public:
+    MemoState() = default;
+
+    Result eval(const value_t<Args>&... values)
     {
-        impl::for_each([binding](const auto& arg) { bind(binding, arg); }, expr.args);
+        auto key = std::tuple_cat(MemoKey<Args>::make(values)...);
+        for (auto it = entries.begin(); it != entries.end(); ++it) {
+            if (it->key == key) {
+                ++hits_;
+                ++MemoTotals::hits();
+                entries.splice(entries.begin(), entries, it);
+                return it->result;
+            }
+        }
+
+        ++misses_;
+        ++MemoTotals::misses();
+        if (entries.size() == N)
+            entries.pop_back();
+        entries.push_front(Entry{std::move(key), Action{}(values...)});
+        return entries.front().result;
     }
 
-    // clang-format off
-    template <typename E,             typename F> static auto invoke(const E&  ,       const F& f) -> decltype(f(        ))       { return f(        ); }
-    template <typename E,             typename F> static auto invoke(const E& e,       const F& f) -> decltype(f(e.eval()))       { return f(e.eval()); }
-    template <typename E, typename C, typename F> static auto invoke(const E&  , C* r, const F& f) -> decltype((r->*f)(        )) { return (r->*f)(        ); }
-    template <typename E, typename C, typename F> static auto invoke(const E& e, C* r, const F& f) -> decltype((r->*f)(e.eval())) { return (r->*f)(e.eval()); }
-    // clang-format on
+    qint64 hits() const { return hits_; }
+    qint64 misses() const { return misses_; }
+
+private:
+    struct Entry
+    {
+        Key    key;
+        Result result;
+    };
+
+    std::list<Entry> entries; // Most recently used first
+    qint64           hits_   = 0;
+    qint64           misses_ = 0;
+};
+
+// Whether an argument lets the node keep its last result: variable ones are compared, constant ones never change
+template <typename Arg, bool = is_meta_property_v<Arg> || is_binding_expr_v<Arg>>
+struct is_key_arg : is_cutoff_arg<std::decay_t<typename BindingExpr<ActionEmpty, Arg>::Type>>
+{
+};
+
+template <typename Arg> struct is_key_arg<Arg, false> : is_stable_arg<Arg>
+{
 };
 
+template <typename Action, typename... Args>
+struct is_cutoff_node
+    : std::integral_constant<bool,
+                             fold<std::logical_and<bool>, std::true_type, is_key_arg<Args>...>::value
+                                 && !std::is_void<typename BindingExpr<Action, Args...>::Type>::value>
+{
+};
+
+// Node skipping its action while its arguments are unchanged, so an unchanged result stops propagating there. A node
+// with an argument which can't be compared is a plain one
+template <typename Action,
+          typename... Args,
+          std::enable_if_t<is_cutoff_node<Action, std::decay_t<Args>...>::value, bool> = true>
+auto makeCutoff(Args&&... args)
+{
+    return makeBindingExpr<ActionNode>(std::make_shared<MemoState<Action, 1, std::decay_t<Args>...>>(),
+                                       std::forward<Args>(args)...);
+}
+
+template <typename Action,
+          typename... Args,
+          std::enable_if_t<!is_cutoff_node<Action, std::decay_t<Args>...>::value, bool> = true>
+auto makeCutoff(Args&&... args)
+{
+    return makeBindingExpr<Action>(std::forward<Args>(args)...);
+}
+
+template <typename Container>
+using aggregate_prop_t = std::decay_t<decltype(*std::begin(std::declval<const Container&>()))>;
+
+template <typename Container> using aggregate_type_t = std::decay_t<typename aggregate_prop_t<Container>::Type>;
+
+template <typename Container, typename Fold> auto makeAggregate(const Container& props, Fold fold)
+{
+    return makeBindingExpr<ActionNode>(
+        std::make_shared<AggregateState<aggregate_prop_t<Container>, Fold>>(props, std::move(fold)));
+}
+
+} // namespace impl
+
 template <typename Action, typename... Args> class BindingExpr<Action, Args...>
 {
     template <typename...> friend class BindingExpr;
+    friend struct impl::TwoWay;
+    friend struct impl::Memo;
+
+    template <typename A = Action, std::enable_if_t<!impl::is_lazy_action<A>::value, bool> = true>
+    static auto result() -> decltype(A{}(BindingExpr<>::eval(std::declval<Args>())...));
+
+    template <typename A = Action, std::enable_if_t<impl::is_lazy_action<A>::value, bool> = true>
+    static auto result() -> decltype(A{}(std::declval<impl::Lazy<Args>>()...));
 
 public:
-    using Type = decltype(Action{}(BindingExpr<>::eval(std::declval<Args>())...));
+    using Type = decltype(result());
 
     explicit BindingExpr(const Args&... args) : args(args...) {}
 
@@ -146,40 +3000,38 @@ public:
         return invoke(f, *this, std::forward<As>(args)...);
     }
 
-    auto eval() const
-    {
-        return impl::apply(Action{}, impl::for_each([](const auto& arg) { return BindingExpr<>::eval(arg); }, args));
-    }
+    auto eval() const { return eval(impl::is_lazy_action<Action>{}); }
 
     template <typename... T> auto bindTo(MetaProperty<T...> prop, Qt::ConnectionType type = Qt::AutoConnection) const
     {
         return bindTo(
             prop.object(),
-            [expr = *this, prop]() { prop.set(expr.eval()); },
-            MetaProperty<T...>::Info::bindingName(),
-            type);
+            [expr = *this, last = impl::Cutoff<typename MetaProperty<T...>::Type>(), prop]() mutable
+            {
+                const typename MetaProperty<T...>::Type value = expr.eval();
+                if (last.changed(value))
+                    prop.set(value);
+            },
+            impl::bindingKey<typename MetaProperty<T...>::Info>(),
+            type,
+            MetaProperty<T...>::Info::name());
     }
 
-    template <typename Func> auto bindTo(Func func) const { return bindTo((QObject*)nullptr, func); }
-
-#ifdef Q_CC_MSVC
-#define FUNCSIG __FUNCSIG__
-#elif Q_CC_GNU
-#define FUNCSIG __PRETTY_FUNCTION__
-#else
-#define FUNCSIG ""
-#endif
+    template <typename Func> auto bindTo(Func func, Qt::ConnectionType type = Qt::AutoConnection) const
+    {
+        return bindTo((QObject*)nullptr, func, type);
+    }
 
     template <typename Class,
               typename Func,
               std::enable_if_t<std::is_member_function_pointer<Func>::value, bool> = true>
     auto bindTo(Class* receiver, Func func, Qt::ConnectionType type = Qt::AutoConnection) const
     {
-        static const QString bindingName = QStringLiteral("nwidget_binding_to_mem_func::") + FUNCSIG;
         return bindTo(
             receiver,
-            [expr = *this, receiver, func]() { BindingExpr<>::invoke(expr, receiver, func); },
-            bindingName,
+            [expr = *this, last = impl::Cutoff<std::decay_t<Type>>(), receiver, func]() mutable
+            { BindingExpr<>::invoke(expr, last, receiver, func); },
+            impl::bindingKey<void(BindingExpr, Class*, Func)>(),
             type);
     }
 
@@ -188,53 +3040,199 @@ public:
               std::enable_if_t<!std::is_member_function_pointer<Func>::value, bool> = true>
     auto bindTo(Class* receiver, Func func, Qt::ConnectionType type = Qt::AutoConnection) const
     {
-        static const QString bindingName = QStringLiteral("nwidget_binding_to_func::") + FUNCSIG;
-        return bindTo(receiver, [expr = *this, func]() { BindingExpr<>::invoke(expr, func); }, bindingName, type);
+        return bindTo(
+            receiver,
+            [expr = *this, last = impl::Cutoff<std::decay_t<Type>>(), func]() mutable
+            { BindingExpr<>::invoke(expr, last, func); },
+            impl::bindingKey<void(BindingExpr, Class*, Func)>(),
+            type);
     }
 
-#undef FUNCSIG
-
 private:
     std::tuple<Args...> args;
 
+    auto eval(std::false_type) const
+    {
+        return impl::apply(Action{}, impl::for_each([](const auto& arg) { return BindingExpr<>::eval(arg); }, args));
+    }
+
+    auto eval(std::true_type) const
+    {
+        return impl::apply(Action{},
+                           impl::for_each([](const auto& arg) { return impl::Lazy<std::decay_t<decltype(arg)>>(arg); },
+                                          args));
+    }
+
     template <typename Class, typename Func>
-    auto bindTo(Class* receiver, Func func, const QString& name, Qt::ConnectionType type = Qt::AutoConnection) const
+    BindingHandle bindTo(Class*             receiver,
+                         Func               func,
+                         impl::BindingKey   key,
+                         Qt::ConnectionType type = Qt::AutoConnection,
+                         const char*        name = nullptr) const
     {
-        QSignalMapper* binding = nullptr;
+        // Evaluated and written in the thread of the receiver, as a queued slot of it
+        if (receiver && receiver->thread() != QThread::currentThread()) {
+            QMetaObject::invokeMethod(
+                receiver,
+                [expr = *this, receiver, func, key, type, name]() { expr.bindTo(receiver, func, key, type, name); },
+                Qt::QueuedConnection);
+            return BindingHandle();
+        }
 
-        if (receiver)
-            binding = receiver->template findChild<QSignalMapper*>(name, Qt::FindDirectChildrenOnly);
+        auto           owner   = receiver ? impl::BindingObject::find(receiver) : nullptr;
+        impl::Binding* binding = owner ? owner->findBinding(key) : nullptr;
 
-        if (!impl::is_observable_v<BindingExpr>) {
-            if (binding)
-                binding->disconnect();
+        if (!BindingExpr<>::observable(*this)) {
+            delete binding;
             func();
-            return *this;
+            return BindingHandle();
         }
 
-        if (binding) {
-            binding->disconnect();
-        } else {
-            binding = new QSignalMapper(receiver);
-            binding->setObjectName(name);
-        }
+        if (binding)
+            binding->rebind();
+        else
+            binding = new impl::Binding(receiver ? impl::BindingObject::get(receiver) : nullptr, key);
 
         BindingExpr<>::bind(binding, *this);
+        binding->setName(name);
+        binding->setFunc(func, type);
+        binding->refresh();
 
-#if QT_VERSION >= QT_VERSION_CHECK(5, 15, 0)
-        QObject::connect(binding, &QSignalMapper::mappedInt, binding, func, type);
-#else
-        QObject::connect(binding, QOverload<int>::of(&QSignalMapper::mapped), binding, func, type);
-#endif
+        return BindingHandle(binding);
+    }
+};
 
-        func();
+/**
+ * @brief Expression evaluated once per propagation, shared by any number of other expressions and bindings.
+ * @details
+ * Copying a BindingExpr copies its tree, so each binding evaluates it again. Computed caches the value instead:
+ *      @code{.cpp}
+ *      Computed<QString> text = asprintf_("%d", a.value() + b.value());
+ *      label1.text() = text;
+ *      label2.text() = "Total: " + text;
+ *      @endcode
+ * Copies share the same node. It stops updating once an object read by the expression is destroyed.
+ */
+template <typename T> class Computed : public BindingExpr<impl::ActionNode, std::shared_ptr<impl::ComputedState<T>>>
+{
+    using Base = BindingExpr<impl::ActionNode, std::shared_ptr<impl::ComputedState<T>>>;
+
+public:
+    template <typename... Ts>
+    Computed(const BindingExpr<Ts...>& expr) : Base(std::make_shared<impl::ComputedState<T>>(expr))
+    {
+    }
+
+    template <typename... Ts>
+    Computed(MetaProperty<Ts...> prop) : Base(std::make_shared<impl::ComputedState<T>>(makeBindingExpr(prop)))
+    {
+    }
+
+    T get() const { return Base::eval(); }
+};
+
+/**
+ * @brief Observable value cell usable as an expression leaf, without QObject or notify signal.
+ * @details
+ * Assigning a different value propagates to the bindings reading it, copies share the same cell:
+ *      @code{.cpp}
+ *      Value<int> count = 0;
+ *      label.text() = asprintf_("%d items", count);
+ *      count = 42;
+ *      count = other; // Assigns the value of other, the cells stay apart
+ *      @endcode
+ * A Value is not thread-safe, it is read and written in the thread of its bindings.
+ */
+template <typename T> class Value : public BindingExpr<impl::ActionNode, std::shared_ptr<impl::ValueState<T>>>
+{
+    using Base = BindingExpr<impl::ActionNode, std::shared_ptr<impl::ValueState<T>>>;
+
+public:
+    Value(T value = T()) : Value(std::make_shared<impl::ValueState<T>>(std::move(value))) {}
+    Value(const Value&) = default;
+
+    T get() const { return Base::eval(); }
+
+    void set(T value) const { state->set(std::move(value)); }
 
+    Value& operator=(T value)
+    {
+        set(std::move(value));
+        return *this;
+    }
+
+    // Through the cell, re-seating it would detach the bindings reading this one
+    Value& operator=(const Value& other)
+    {
+        set(other.get());
         return *this;
     }
+
+private:
+    std::shared_ptr<impl::ValueState<T>> state;
+
+    explicit Value(const std::shared_ptr<impl::ValueState<T>>& state) : Base(state), state(state) {}
 };
 
 namespace impl {
 
+// Rebuilds a node as a memo_() node with the same arguments
+struct Memo
+{
+    template <std::size_t N, typename Action, typename... Args>
+    static auto make(const BindingExpr<Action, Args...>& expr)
+    {
+        return impl::apply(
+            [](const Args&... args)
+            { return makeBindingExpr<ActionNode>(std::make_shared<MemoState<Action, N, Args...>>(), args...); },
+            expr.args);
+    }
+
+    // The node of invoke() keeps N results instead of its last one
+    template <std::size_t N, typename Action, std::size_t M, typename... Args>
+    static auto make(const BindingExpr<ActionNode, std::shared_ptr<MemoState<Action, M, Args...>>, Args...>& expr)
+    {
+        return impl::apply(
+            [](const std::shared_ptr<MemoState<Action, M, Args...>>&, const Args&... args)
+            { return makeBindingExpr<ActionNode>(std::make_shared<MemoState<Action, N, Args...>>(), args...); },
+            expr.args);
+    }
+
+    template <typename Action, std::size_t N, typename... Args>
+    static const MemoState<Action, N, Args...>&
+    cache(const BindingExpr<ActionNode, std::shared_ptr<MemoState<Action, N, Args...>>, Args...>& expr)
+    {
+        return *std::get<0>(expr.args);
+    }
+};
+
+// One direction of twoWay(), not writing back within the propagation that wrote the other direction
+struct TwoWay
+{
+    template <typename Expr, typename Prop>
+    static BindingHandle bind(const Expr& expr, Prop prop, std::shared_ptr<quint64> epoch, bool skipFirst)
+    {
+        using T = typename Prop::Type;
+        return expr.bindTo(
+            prop.object(),
+            [expr, last = Cutoff<T>(), prop, epoch, skipFirst]() mutable
+            {
+                const T    value   = expr.eval();
+                const bool changed = last.changed(value); // Kept up to date while skipped
+                const auto now     = BindingEngine::instance().epoch();
+                if (skipFirst || *epoch == now || !changed) {
+                    skipFirst = false;
+                    return;
+                }
+                *epoch = now;
+                prop.set(value);
+            },
+            bindingKey<typename Prop::Info>(),
+            Qt::AutoConnection,
+            Prop::Info::name());
+    }
+};
+
 // clang-format off
 
 template<typename To> struct ActionCast            { template<typename From> auto operator()(From&& from){ return (To)from;                   } };
@@ -242,7 +3240,7 @@ template<typename To> struct ActionStaticCast      { template<typename From> aut
 template<typename To> struct ActionReinterpretCast { template<typename From> auto operator()(From&& from){ return reinterpret_cast<To>(from); } };
 
 template<typename T> struct ActionConstructor { template<typename ...Args> T operator()(Args&&... args){ return T(std::forward<Args>(args)...); } };
-struct ActionCond { template<typename A, typename B, typename C> auto operator()(A&& a, B&& b, C&& c) { return a ? b : c; } };
+struct ActionCond : LazyAction { template<typename A, typename B, typename C> auto operator()(const A& a, const B& b, const C& c) const { return a() ? b() : c(); } };
 
 // clang-format on
 
@@ -279,6 +3277,14 @@ struct ActionInvoke
     }
 };
 
+struct ActionLazyInvoke : LazyAction
+{
+    template <typename F, typename... Args> auto operator()(const F& fn, const Args&... args) const
+    {
+        return fn()(args...);
+    }
+};
+
 struct ActionSubscript
 {
     template <typename T, typename I> auto operator()(T&& v, I&& i) const { return v[std::forward<I>(i)]; }
@@ -294,12 +3300,51 @@ template<typename To, typename From> auto reinterpret_cast_(From&& from) { retur
 
 template<typename A, typename B, typename C> auto cond(const A& a, const B& b, const C& c) { return makeBindingExpr<impl::ActionCond>(a, b, c); }
 
-template<typename F, typename ...Args> auto invoke(F func, Args&&... args) { return makeBindingExpr<impl::ActionInvoke>(func, std::forward<Args>(args)...); }
+// Keeps its last result while its arguments compare equal, func is assumed to depend on them only
+template<typename F, typename ...Args> auto invoke(F func, Args&&... args) { return impl::makeCutoff<impl::ActionInvoke>(func, std::forward<Args>(args)...); }
+
+// func receives a thunk per argument, see LazyAction
+template<typename F, typename ...Args> auto lazy_invoke(F func, Args&&... args) { return makeBindingExpr<impl::ActionLazyInvoke>(func, std::forward<Args>(args)...); }
 
 template<typename T, typename I> auto subscript(T&& v, I&& i) { return makeBindingExpr<impl::ActionSubscript>(std::forward<T>(v), std::forward<I>(i)); }
 
 template<typename T, typename ...Args> auto constructor(Args&&... args) { return makeBindingExpr<impl::ActionConstructor<T>>(std::forward<Args>(args)...); }
 
+// fn runs in QThreadPool with the arguments evaluated in the calling thread, the node yields its latest result, R{} until
+// the first one. An exception thrown by fn is reported with qWarning()
+template<typename F, typename ...Args> auto async_(F fn, Args&&... args)                          { return makeBindingExpr<impl::ActionNode>(std::make_shared<typename impl::async_state<F, Args...>::type>(fn), std::forward<Args>(args)...); }
+// Same as async_, but yields placeholder while computing
+template<typename P, typename F, typename ...Args> auto async_or_(P placeholder, F fn, Args&&... args) { return makeBindingExpr<impl::ActionNode>(std::make_shared<typename impl::async_state<F, Args...>::type>(fn, placeholder), std::forward<Args>(args)...); }
+
+// Yields the first change at once, then at most the latest change per ms
+template<typename E> auto throttle(const E& expr, int ms) { using S = impl::TimedState<decltype(makeBindingExpr(expr))>; return makeBindingExpr<impl::ActionNode>(std::make_shared<S>(makeBindingExpr(expr), ms, S::Throttle)); }
+// Yields a change once expr stayed unchanged for ms
+template<typename E> auto debounce(const E& expr, int ms) { using S = impl::TimedState<decltype(makeBindingExpr(expr))>; return makeBindingExpr<impl::ActionNode>(std::make_shared<S>(makeBindingExpr(expr), ms, S::Debounce)); }
+// Yields the latest value of expr every ms, while it changes
+template<typename E> auto sample(const E& expr, int ms)   { using S = impl::TimedState<decltype(makeBindingExpr(expr))>; return makeBindingExpr<impl::ActionNode>(std::make_shared<S>(makeBindingExpr(expr), ms, S::Sample)); }
+
+// Aggregates over a runtime container of MetaProperty, updated in O(1) or O(log n) per changed property
+template<typename C>             auto sum_(const C& props)                { return impl::makeAggregate(props, impl::FoldSum     <impl::aggregate_type_t<C>>()); }
+template<typename C>             auto min_(const C& props)                { return impl::makeAggregate(props, impl::FoldExtremum<impl::aggregate_type_t<C>, std::less   <impl::aggregate_type_t<C>>>()); }
+template<typename C>             auto max_(const C& props)                { return impl::makeAggregate(props, impl::FoldExtremum<impl::aggregate_type_t<C>, std::greater<impl::aggregate_type_t<C>>>()); }
+template<typename C, typename P> auto count_if_(const C& props, P pred)   { return impl::makeAggregate(props, impl::FoldCount   <impl::aggregate_type_t<C>, P>(pred)); }
+template<typename C, typename P> auto any_(const C& props, P pred)        { return impl::makeAggregate(props, impl::FoldAny     <impl::aggregate_type_t<C>, P>(pred)); }
+template<typename C, typename P> auto all_(const C& props, P pred)        { return impl::makeAggregate(props, impl::FoldAll     <impl::aggregate_type_t<C>, P>(pred)); }
+template<typename C>             auto any_(const C& props)                { return any_(props, impl::Truthy()); }
+template<typename C>             auto all_(const C& props)                { return all_(props, impl::Truthy()); }
+
+// Caches the results of the last N argument tuples of the root node of expr, as decoded icons, pixmaps or fonts. Constant
+// arguments, as the function of invoke(), are not part of the key
+template<std::size_t N = N_BINDING_MEMO_CAPACITY, typename A, typename ...Args> auto memo_(const BindingExpr<A, Args...>& expr) { return impl::Memo::make<N>(expr); }
+
+// Number of evaluations of a memo_() expression served from its cache, shared by its copies, and of the other ones
+template<typename ...Ts> qint64 memoHits  (const BindingExpr<Ts...>& expr) { return impl::Memo::cache(expr).hits(); }
+template<typename ...Ts> qint64 memoMisses(const BindingExpr<Ts...>& expr) { return impl::Memo::cache(expr).misses(); }
+
+// Totals of memoHits() and memoMisses() over every memo_() expression
+inline qint64 memoHits()   { return impl::MemoTotals::hits(); }
+inline qint64 memoMisses() { return impl::MemoTotals::misses(); }
+
 // clang-format on
 
 template <typename... Args> auto asprintf_(const char* cformat, const Args&... args)
@@ -307,18 +3352,34 @@ template <typename... Args> auto asprintf_(const char* cformat, const Args&... a
     return invoke(QString::asprintf, cformat, args...);
 }
 
+/**
+ * @brief Keeps two properties in sync, b following fwd(a) and a following back(b).
+ * @details
+ * b is initialized from a. A change flows one way only: the side written by a propagation is not written back within
+ * that propagation, even when fwd and back do not round trip exactly:
+ *      @code{.cpp}
+ *      twoWay(slider.value(), box.value(), [](int v) { return v / 10.0; }, [](double v) { return qRound(v * 10); });
+ *      @endcode
+ * Returns the handles of the forward and backward bindings. Binding either property again replaces its direction.
+ */
+template <typename... A, typename... B, typename F, typename G>
+std::pair<BindingHandle, BindingHandle> twoWay(MetaProperty<A...> a, MetaProperty<B...> b, F fwd, G back)
+{
+    const auto epoch    = std::make_shared<quint64>(~quint64(0));
+    auto       forward  = impl::TwoWay::bind(invoke(fwd, a), b, epoch, false);
+    auto       backward = impl::TwoWay::bind(invoke(back, b), a, epoch, true);
+    return std::make_pair(std::move(forward), std::move(backward));
+}
+
+template <typename... A, typename... B>
+std::pair<BindingHandle, BindingHandle> twoWay(MetaProperty<A...> a, MetaProperty<B...> b)
+{
+    return twoWay(a, b, impl::ActionEmpty(), impl::ActionEmpty());
+}
+
 } // namespace nwidget
 
-#define N_IMPL_ACTION_BE(NAME, OP)                                                                                     \
-    namespace nwidget {                                                                                                \
-    namespace impl {                                                                                                   \
-    struct Action##NAME                                                                                                \
-    {                                                                                                                  \
-        template <typename L, typename R> auto operator()(L&& l, R&& r) const { return l OP r; }                       \
-    };                                                                                                                 \
-    }                                                                                                                  \
-    }                                                                                                                  \
-                                                                                                                       \
+#define N_IMPL_OPERATOR_BE(NAME, OP)                                                                                   \
     template <typename L,                                                                                              \
               typename R,                                                                                              \
               std::enable_if_t<nwidget::impl::is_meta_property_v<std::decay_t<L>>                                      \
@@ -331,6 +3392,31 @@ template <typename... Args> auto asprintf_(const char* cformat, const Args&... a
         return nwidget::makeBindingExpr<nwidget::impl::Action##NAME>(std::forward<L>(l), std::forward<R>(r));          \
     }
 
+#define N_IMPL_ACTION_BE(NAME, OP)                                                                                     \
+    namespace nwidget {                                                                                                \
+    namespace impl {                                                                                                   \
+    struct Action##NAME                                                                                                \
+    {                                                                                                                  \
+        template <typename L, typename R> auto operator()(L&& l, R&& r) const { return l OP r; }                       \
+    };                                                                                                                 \
+    }                                                                                                                  \
+    }                                                                                                                  \
+                                                                                                                       \
+    N_IMPL_OPERATOR_BE(NAME, OP)
+
+// Short-circuit, the right operand is only evaluated when needed
+#define N_IMPL_LAZY_ACTION_BE(NAME, OP)                                                                                \
+    namespace nwidget {                                                                                                \
+    namespace impl {                                                                                                   \
+    struct Action##NAME : LazyAction                                                                                   \
+    {                                                                                                                  \
+        template <typename L, typename R> auto operator()(const L& l, const R& r) const { return l() OP r(); }         \
+    };                                                                                                                 \
+    }                                                                                                                  \
+    }                                                                                                                  \
+                                                                                                                       \
+    N_IMPL_OPERATOR_BE(NAME, OP)
+
 N_IMPL_ACTION_BE(Add, +)
 N_IMPL_ACTION_BE(Sub, -)
 N_IMPL_ACTION_BE(Mul, *)
@@ -343,8 +3429,8 @@ N_IMPL_ACTION_BE(LE, <=)
 N_IMPL_ACTION_BE(GT, >)
 N_IMPL_ACTION_BE(GE, >=)
 
-N_IMPL_ACTION_BE(And, &&)
-N_IMPL_ACTION_BE(Or, ||)
+N_IMPL_LAZY_ACTION_BE(And, &&)
+N_IMPL_LAZY_ACTION_BE(Or, ||)
 
 N_IMPL_ACTION_BE(BitAnd, &)
 N_IMPL_ACTION_BE(BitOR, |)
@@ -392,7 +392,7 @@ template <typename Self> class nwidget::Builder<QWidget, Self> : public nwidget:
     N_BUILDER_PROPERTY(maximumHeight)
     N_BUILDER_PROPERTY(sizeIncrement)
     N_BUILDER_PROPERTY(baseSize)
-    N_BUILDER_PROPERTY(alette)
+    N_BUILDER_PROPERTY(palette)
     N_BUILDER_PROPERTY(font)
 #ifndef QT_NO_CURSOR
     N_BUILDER_PROPERTY(cursor)
@@ -446,7 +446,6 @@ template <typename Self> class nwidget::Builder<QWidget, Self> : public nwidget:
     N_BUILDER_SETTERX(fixedSize, setFixedSize, int, int)
     N_BUILDER_SETTER1(fixedWidth, setFixedWidth)
     N_BUILDER_SETTER1(fixedHeight, setFixedHeight)
-    N_BUILDER_SETTER1(palette, setPalette)
     N_BUILDER_SETTER1(backgroundRole, setBackgroundRole)
     N_BUILDER_SETTER1(foregroundRole, setForegroundRole)
     N_BUILDER_SETTER1(mouseTracking, setMouseTracking)
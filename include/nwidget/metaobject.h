@@ -60,7 +60,6 @@ template <typename...> class MetaProperty;
 template <typename C, // Class
           typename I, // PropInfo: struct {
                       //    static constexpr const char* name() { return "propName"; }
-                      //    static QString bindingName() { return "nwidget_binding_on_propName"; }
                       // }
           typename T, // Type
           typename G, // Getter: struct { auto operator()(const C* o)  const { return o->Getter(); } }
@@ -123,7 +122,10 @@ public:
 
     // clang-format on
 
-    template <typename... Ts> void bindTo(MetaProperty<Ts...> prop) const { makeBindingExpr(*this).bindTo(prop); }
+    template <typename... Ts> auto bindTo(MetaProperty<Ts...> prop) const
+    {
+        return makeBindingExpr(*this).bindTo(prop);
+    }
 
     // The return behavior of operator= is undetermined, currently we let it return void
     void                           operator=(const Type& val) { set(val); }
@@ -201,7 +203,6 @@ auto create_if_default_constructible()
         struct _I                                                                                                      \
         {                                                                                                              \
             static const char* name() { return #NAME; }                                                                \
-            static QString     bindingName() { return QStringLiteral("nwidget_binding_on_" #NAME); }                   \
         };                                                                                                             \
                                                                                                                        \
         using _C = CLASS;                                                                                              \
@@ -222,7 +223,6 @@ public:
         struct _I                                                                                                      \
         {                                                                                                              \
             static const char* name() { return #NAME; }                                                                \
-            static QString     bindingName() { return QStringLiteral("nwidget_binding_on_" #NAME); }                   \
         };                                                                                                             \
                                                                                                                        \
         using _C = Class;                                                                                              \
@@ -24,7 +24,7 @@ template <> class nwidget::MetaObject<QAction> : public MetaObject<QObject>
     N_OBJECT(QAction, QObject)
 
     N_BEGIN_PROPERTY
-    N_UNTIL(6, 0, N_PROPERTY(bool, checkable, N_READ isCheckable N_WRITE setCheckable N_NOTIFY toggled))
+    N_UNTIL(6, 0, N_PROPERTY(bool, checkable, N_READ isCheckable N_WRITE setCheckable N_NOTIFY changed))
     N_SINCE(6, 0, N_PROPERTY(bool, checkable, N_READ isCheckable N_WRITE setCheckable N_NOTIFY checkableChanged))
     N_PROPERTY(bool, checked, N_READ isChecked N_WRITE setChecked N_NOTIFY toggled)
     N_UNTIL(6, 0, N_PROPERTY(bool, enabled, N_READ isEnabled N_WRITE setEnabled N_NOTIFY changed))
@@ -190,7 +190,7 @@ template <> class nwidget::MetaObject<QWidget> : public MetaObject<QObject>
     N_PROPERTY(int, maximumHeight, N_READ maximumHeight N_WRITE setMaximumHeight)
     N_PROPERTY(QSize, sizeIncrement, N_READ sizeIncrement N_WRITE setSizeIncrement)
     N_PROPERTY(QSize, baseSize, N_READ baseSize N_WRITE setBaseSize)
-    N_PROPERTY(QPalette, alette, N_READ palette N_WRITE setPalette)
+    N_PROPERTY(QPalette, palette, N_READ palette N_WRITE setPalette)
     N_PROPERTY(QFont, font, N_READ font N_WRITE setFont)
 #ifndef QT_NO_CURSOR
     N_PROPERTY(QCursor, cursor, N_READ cursor N_WRITE setCursor)
@@ -86,6 +86,7 @@ constexpr auto for_each(const Fn& f, const Tup& t, std::index_sequence<I...>)
     -> std::enable_if_t<fold<std::logical_and<bool>, std::is_void<decltype(f(std::get<I>(t)))>...>::value>
 {
     int _[]{(f(std::get<I>(t)), 0)...};
+    Q_UNUSED(_);
 }
 
 template <typename Fn, typename Tup, size_t... I>
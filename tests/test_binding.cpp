@@ -1,10 +1,15 @@
+#include <QAction>
 #include <QLabel>
+#include <QRegularExpression>
+#include <QScrollArea>
 #include <QTest>
 
 #include <QSlider>
 #include <nwidget/binding.h>
 #include <nwidget/metaobjects.h>
 
+#include <stdexcept>
+
 struct MyValue
 {
     MyValue() {}
@@ -41,13 +46,111 @@ template <> class nwidget::MetaObject<MyObject> : public MetaObject<QObject>
     N_END_PROPERTY
 };
 
+// Counts the calls of its getter
+class MyCounter : public QObject
+{
+    Q_OBJECT
+
+public:
+    int value() const
+    {
+        ++reads;
+        return value_;
+    }
+
+    void setValue(int v)
+    {
+        if (value_ == v)
+            return;
+        value_ = v;
+        emit valueChanged(v);
+    }
+
+    mutable int reads = 0;
+
+signals:
+    void valueChanged(int);
+
+private:
+    int value_ = 0;
+};
+
+template <> class nwidget::MetaObject<MyCounter> : public MetaObject<QObject>
+{
+    N_OBJECT(MyCounter, QObject)
+
+    N_BEGIN_PROPERTY
+    N_PROPERTY(int, value, N_READ value N_WRITE setValue N_NOTIFY valueChanged)
+    N_END_PROPERTY
+};
+
+// Two properties sharing a notify signal without argument, counts the calls of the title getter
+class MyDocument : public QObject
+{
+    Q_OBJECT
+    Q_PROPERTY(QString title READ title WRITE setTitle NOTIFY changed)
+    Q_PROPERTY(QString body READ body WRITE setBody NOTIFY changed)
+
+public:
+    QString title() const
+    {
+        ++reads;
+        return title_;
+    }
+
+    QString body() const { return body_; }
+
+    void setTitle(const QString& v)
+    {
+        title_ = v;
+        emit changed();
+    }
+
+    void setBody(const QString& v)
+    {
+        body_ = v;
+        emit changed();
+    }
+
+    mutable int reads = 0;
+
+signals:
+    void changed();
+
+private:
+    QString title_;
+    QString body_;
+};
+
+template <> class nwidget::MetaObject<MyDocument> : public MetaObject<QObject>
+{
+    N_OBJECT(MyDocument, QObject)
+
+    N_BEGIN_PROPERTY
+    N_PROPERTY(QString, title, N_READ title N_WRITE setTitle N_NOTIFY changed)
+    N_PROPERTY(QString, body, N_READ body N_WRITE setBody N_NOTIFY changed)
+    N_END_PROPERTY
+};
+
 using namespace nwidget;
 
+// Calls of counted(), reset before each test
+static int calls = 0;
+
+// Identity counting its calls
+template <typename T> T counted(T v)
+{
+    ++calls;
+    return v;
+}
+
 class TestBinding : public QObject
 {
     Q_OBJECT
 
 private slots:
+    void init() { calls = 0; }
+
     void testBindingExpr()
     {
         using MetaObj = MetaObject<QSlider>;
@@ -62,7 +165,7 @@ private slots:
 
         using Expr3 = decltype(std::declval<MetaObj>().x());
         static_assert(std::is_same<Expr3::Type, int>::value, "");
-        static_assert(!impl::is_observable_v<Expr3>, "");
+        static_assert(impl::is_observable_v<Expr3>, "");
 
         using Expr4 = decltype(std::declval<MetaObj>().value() + std::declval<MetaObj>().x());
         static_assert(std::is_same<Expr4::Type, int>::value, "");
@@ -476,11 +579,11 @@ private slots:
             s1.value() = s2.value() + 10;
             QCOMPARE(s1.value().get(), s2.value().get() + 10);
 
-            s1.value() = s2.x() + 20;
-            auto value = _s2.x() + 20;
+            s1.value() = s2.minimumWidth() + 20;
+            auto value = _s2.minimumWidth() + 20;
             QCOMPARE(s1.value().get(), value);
 
-            _s2.move(20, 30);
+            _s2.setMinimumWidth(20);
             QCOMPARE(s1.value().get(), value);
         }
 
@@ -527,25 +630,26 @@ private slots:
         {
             QSlider s3;
 
-            auto expr = s1.x() + 10;
-            auto val1 = _s1.x() + 10;
+            // neither notified by a signal nor by an event
+            auto expr = s1.minimumWidth() + 10;
+            auto val1 = _s1.minimumWidth() + 10;
 
             // bind To slot
             expr.bindTo(&s3, &QSlider::setValue);
 
             QCOMPARE(val1, s3.value());
 
-            _s1.move(20, 30);
+            _s1.setMinimumWidth(20);
             QCOMPARE(val1, s3.value());
 
             // bind To func
-            int  val2 = _s1.x() + 10;
+            int  val2 = _s1.minimumWidth() + 10;
             auto func = [&val1](int v) { val1 = v; };
             expr.bindTo(func);
 
             QCOMPARE(val1, val2);
 
-            _s1.move(30, 40);
+            _s1.setMinimumWidth(30);
             QCOMPARE(val1, val2);
         }
 
@@ -560,12 +664,1001 @@ private slots:
             s3.value() = obj.value()(s1.value(), s2.value());
             auto expr  = [&_obj, &_s1, &_s2]() { return _obj.value()(_s1.value(), _s2.value()); };
 
-            QCOMPARE(s3.value().get(), expr());
+            QCOMPARE(qreal(s3.value().get()), expr());
 
             s1.value() = 11;
             s2.value() = 45;
-            QCOMPARE(s3.value().get(), expr());
+            QCOMPARE(qreal(s3.value().get()), expr());
+        }
+    }
+
+    void testPropagation()
+    {
+        QSlider _a;
+        QSlider _b;
+        QSlider _c;
+
+        auto a = MetaObject<>::from(&_a);
+        auto b = MetaObject<>::from(&_b);
+        auto c = MetaObject<>::from(&_c);
+
+        QList<int> values;
+        (b.value() + c.value()).bindTo([&values](int v) { values.append(v); });
+
+        // bindings created after their dependents still rank before them
+        b.value() = a.value();
+        c.value() = a.value() * 2;
+
+        values.clear();
+        a.value() = 10;
+        QCOMPARE(values, QList<int>{30});
+
+        a.value() = 3;
+        QCOMPARE(values, (QList<int>{30, 9}));
+    }
+
+    void testDeferredBinding()
+    {
+        QSlider _s1;
+        QSlider _s2;
+
+        auto s1 = MetaObject<>::from(&_s1);
+        auto s2 = MetaObject<>::from(&_s2);
+
+        int count = 0;
+        int value = 0;
+        (s1.value() + s2.value()).bindTo(
+            [&count, &value](int v)
+            {
+                ++count;
+                value = v;
+            },
+            Qt::QueuedConnection);
+        QCOMPARE(count, 1);
+
+        for (int i = 1; i <= 50; ++i) {
+            s1.value() = i;
+            s2.value() = i;
+        }
+        QCOMPARE(count, 1);
+
+        QCoreApplication::processEvents();
+        QCOMPARE(count, 2);
+        QCOMPARE(value, 100);
+    }
+
+    void testTransaction()
+    {
+        QSlider _s1;
+        QSlider _s2;
+
+        auto s1 = MetaObject<>::from(&_s1);
+        auto s2 = MetaObject<>::from(&_s2);
+
+        int count = 0;
+        (s1.value() + s2.value()).bindTo([&count](int) { ++count; });
+
+        {
+            Transaction transaction;
+            for (int i = 1; i <= 10; ++i) {
+                s1.value() = i;
+                s2.value() = i;
+            }
+
+            // nested
+            {
+                Transaction inner;
+                s1.value() = 11;
+            }
+
+            QCOMPARE(count, 1);
+            QCOMPARE(transaction.skipped(), qint64(20));
+        }
+        QCOMPARE(count, 2);
+
+        Transaction::batch(
+            [&]()
+            {
+                s1.value() = 1;
+                s2.value() = 1;
+            });
+        QCOMPARE(count, 3);
+    }
+
+    void testCutoff()
+    {
+        QSlider _s1;
+        QSlider _s2;
+
+        auto s1 = MetaObject<>::from(&_s1);
+        auto s2 = MetaObject<>::from(&_s2);
+
+        // target
+        {
+            int count = 0;
+            (s1.value() / 10).bindTo([&count](int) { ++count; });
+            QCOMPARE(count, 1);
+
+            s1.value() = 5;
+            QCOMPARE(count, 1);
+
+            s1.value() = 15;
+            QCOMPARE(count, 2);
+        }
+
+        // intermediate, an unchanged result of cond() stops at invoke()
+        {
+            QSlider _s3;
+            QSlider _s4;
+            auto    s3 = MetaObject<>::from(&_s3);
+            auto    s4 = MetaObject<>::from(&_s4);
+
+            s3.value() = invoke(&counted<int>, cond(s2.value() > 0, 1, 0));
+            QCOMPARE(calls, 1);
+
+            s2.value() = 1;
+            QCOMPARE(calls, 2);
+
+            s2.value() = 2;
+            QCOMPARE(calls, 2);
+            QCOMPARE(s3.value().get(), 1);
+
+            // nested, the outer invoke() is skipped while the inner result divided by 10 is unchanged
+            s4.value() = invoke(&counted<int>, invoke(&counted<int>, s2.value()) / 10);
+            QCOMPARE(calls, 4);
+
+            s2.value() = 3;
+            QCOMPARE(calls, 5);
+            QCOMPARE(s4.value().get(), 0);
+
+            s2.value() = 12;
+            QCOMPARE(calls, 7);
+            QCOMPARE(s4.value().get(), 1);
+        }
+    }
+
+    void testShortCircuit()
+    {
+        QSlider _s1;
+        QSlider _s2;
+
+        auto s1 = MetaObject<>::from(&_s1);
+        auto s2 = MetaObject<>::from(&_s2);
+
+        // cond
+        auto expr1 = cond(s1.value() > 0, invoke(&counted<int>, s2.value()), 0);
+        QCOMPARE(expr1.eval(), 0);
+        QCOMPARE(calls, 0);
+
+        // && and ||
+        auto expr2 = s1.value() > 0 && invoke(&counted<int>, s2.value()) > 0;
+        auto expr3 = s1.value() == 0 || invoke(&counted<int>, s2.value()) > 0;
+        QCOMPARE(expr2.eval(), false);
+        QCOMPARE(expr3.eval(), true);
+        QCOMPARE(calls, 0);
+
+        // lazy_invoke
+        auto expr4 = lazy_invoke([](auto a, auto b) { return a() ? b() : -1; },
+                                 s1.value() > 0,
+                                 invoke(&counted<int>, s2.value()));
+        QCOMPARE(expr4.eval(), -1);
+        QCOMPARE(calls, 0);
+
+        s1.value() = 1;
+        s2.value() = 2;
+        QCOMPARE(expr1.eval(), 2);
+        QCOMPARE(expr4.eval(), 2);
+        QCOMPARE(calls, 2);
+    }
+
+    void testDynamicDependency()
+    {
+        QSlider _s1;
+        QSlider _s2;
+        QSlider _s3;
+
+        auto s1 = MetaObject<>::from(&_s1);
+        auto s2 = MetaObject<>::from(&_s2);
+        auto s3 = MetaObject<>::from(&_s3);
+
+        int count = 0;
+        cond(s1.value() > 0, s2.value(), s3.value()).bindTo([&count](int) { ++count; });
+        QCOMPARE(count, 1);
+
+        // s2 is not read while s1 is 0
+        s2.value() = 1;
+        QCOMPARE(count, 1);
+
+        s3.value() = 5;
+        QCOMPARE(count, 2);
+
+        // switching branch subscribes to s2 and drops s3, the values differ so the switch is not cut off
+        s1.value() = 1;
+        QCOMPARE(count, 3);
+
+        s3.value() = 2;
+        QCOMPARE(count, 3);
+
+        s2.value() = 2;
+        QCOMPARE(count, 4);
+    }
+
+    void testDeferWhileHidden()
+    {
+        QWidget root;
+        QSlider _s1;
+        auto    _s2 = new QSlider(&root);
+
+        auto s1 = MetaObject<>::from(&_s1);
+        auto s2 = MetaObject<>::from(_s2);
+
+        deferWhileHidden(&root);
+
+        // not evaluated before the first show
+        s2.value() = s1.value() + 1;
+        QCOMPARE(s2.value().get(), 0);
+
+        root.show();
+        QCOMPARE(s2.value().get(), 1);
+
+        s1.value() = 1;
+        QCOMPARE(s2.value().get(), 2);
+
+        // stale while hidden, evaluated once when shown again
+        root.hide();
+        s1.value() = 2;
+        s1.value() = 3;
+        QCOMPARE(s2.value().get(), 2);
+
+        root.show();
+        QCOMPARE(s2.value().get(), 4);
+
+        // held bindings catch up once deferring is turned off
+        root.hide();
+        s1.value() = 4;
+        QCOMPARE(s2.value().get(), 4);
+        deferWhileHidden(&root, false);
+        QCOMPARE(s2.value().get(), 5);
+
+        s1.value() = 5;
+        QCOMPARE(s2.value().get(), 6);
+    }
+
+    void testCullOutsideViewport()
+    {
+        QScrollArea area;
+        auto        content = new QWidget;
+        auto        _s2     = new QSlider(content);
+        content->resize(100, 2000);
+        _s2->setGeometry(0, 1500, 100, 20);
+        area.resize(200, 200);
+        area.setWidget(content);
+        area.show();
+
+        QSlider _s1;
+        auto    s1 = MetaObject<>::from(&_s1);
+        auto    s2 = MetaObject<>::from(_s2);
+
+        cullOutsideViewport(&area);
+
+        // held while scrolled out of view
+        s2.value() = s1.value() + 1;
+        s1.value() = 1;
+        QCOMPARE(s2.value().get(), 0);
+
+        area.verticalScrollBar()->setValue(1450);
+        QCOMPARE(s2.value().get(), 2);
+
+        s1.value() = 2;
+        QCOMPARE(s2.value().get(), 3);
+
+        area.verticalScrollBar()->setValue(0);
+        s1.value() = 3;
+        QCOMPARE(s2.value().get(), 3);
+    }
+
+    void testConstruction()
+    {
+        QSlider _s1;
+        QSlider _s2;
+        QSlider _s3;
+
+        auto s1 = MetaObject<>::from(&_s1);
+        auto s2 = MetaObject<>::from(&_s2);
+        auto s3 = MetaObject<>::from(&_s3);
+
+        s1.value() = 1;
+        {
+            Construction construction;
+
+            // reader created before its writer
+            s3.value() = invoke(&counted<int>, s2.value()) * 2;
+            s2.value() = invoke(&counted<int>, s1.value()) + 1;
+            QCOMPARE(calls, 0);
+            QCOMPARE(s3.value().get(), 0);
         }
+        QCOMPARE(calls, 2);
+        QCOMPARE(s3.value().get(), 4);
+
+        s1.value() = 2;
+        QCOMPARE(calls, 4);
+        QCOMPARE(s3.value().get(), 6);
+
+        const int value = Construction::build(
+            [&]()
+            {
+                s2.value() = invoke(&counted<int>, s1.value()) + 2;
+                return s2.value().get();
+            });
+        QCOMPARE(value, 3);
+        QCOMPARE(s2.value().get(), 4);
+    }
+
+    void testCrossThread()
+    {
+        QThread thread;
+        auto    _worker = new QObject;
+        _worker->moveToThread(&thread);
+        connect(&thread, &QThread::finished, _worker, &QObject::deleteLater);
+        thread.start();
+
+        auto worker = MetaObject<>::from(_worker);
+
+        int     count = 0;
+        QString last;
+        makeBindingExpr(worker.objectName()).bindTo(
+            [&](const QString& v)
+            {
+                ++count;
+                last = v;
+            });
+        QCOMPARE(count, 1);
+
+        // seeded by the worker thread, the getter is never called in this one
+        QTRY_COMPARE(count, 2);
+        QCOMPARE(overwrittenUpdates(worker.objectName()), qint64(0));
+
+        // published in the worker thread, only the latest value is read
+        QMetaObject::invokeMethod(
+            _worker,
+            [_worker]()
+            {
+                for (int i = 1; i <= 100; ++i)
+                    _worker->setObjectName(QString::number(i));
+            },
+            Qt::BlockingQueuedConnection);
+
+        QTRY_COMPARE(last, QString("100"));
+        QCOMPARE(count, 3);
+        QCOMPARE(overwrittenUpdates(worker.objectName()), qint64(99));
+
+        // bindings targeting the worker are created and evaluated in its thread
+        std::atomic<QThread*> evaluatedIn{nullptr};
+        BindingHandle         handle = makeBindingExpr(worker.objectName())
+                                   .bindTo(_worker, [&evaluatedIn](const QString&) { evaluatedIn = QThread::currentThread(); });
+        QVERIFY(!handle.isBound());
+        QTRY_COMPARE(evaluatedIn.load(), &thread);
+
+        thread.quit();
+        thread.wait();
+    }
+
+    void testAsync()
+    {
+        QSlider _s1;
+        QSlider _s2;
+
+        auto s1 = MetaObject<>::from(&_s1);
+        auto s2 = MetaObject<>::from(&_s2);
+
+        s1.value() = 1;
+        s2.value() = async_([](int v) { return v * 2; }, s1.value());
+        QCOMPARE(s2.value().get(), 0);
+        QTRY_COMPARE(s2.value().get(), 2);
+
+        // results of outdated arguments are dropped
+        QVector<int> values;
+        async_or_(-1, [](int v) { return v * 3; }, s1.value()).bindTo([&values](int v) { values.append(v); });
+        s1.value() = 2;
+        s1.value() = 3;
+        QTRY_COMPARE(values.last(), 9);
+        QCOMPARE(values, QVector<int>({-1, 9}));
+        QTRY_COMPARE(s2.value().get(), 6);
+
+        // arguments without operator== are not submitted again by the readers of their result
+        struct Opaque
+        {
+            int v;
+        };
+        std::atomic<int> runs{0};
+        QVector<int>     values1;
+        QVector<int>     values2;
+        auto             opaque = async_or_(
+            -1,
+            [&runs](const Opaque& o, int v)
+            {
+                ++runs;
+                return o.v + v;
+            },
+            Opaque{1},
+            s1.value());
+        opaque.bindTo([&values1](int v) { values1.append(v); });
+        opaque.bindTo([&values2](int v) { values2.append(v); });
+        QTRY_COMPARE(values2.last(), 4);
+        QCOMPARE(values1.last(), 4);
+        QTest::qWait(50);
+        QCOMPARE(runs.load(), 2);
+
+        // results need no default constructor, an exception is reported here and the last result kept
+        struct Boxed
+        {
+            explicit Boxed(int v) : v(v) {}
+            int v;
+        };
+        QVector<int> boxed;
+        async_or_(
+            Boxed(-1),
+            [](int v)
+            {
+                if (v == 5)
+                    throw std::runtime_error("five");
+                return Boxed(v);
+            },
+            s1.value())
+            .bindTo([&boxed](const Boxed& b) { boxed.append(b.v); });
+        QTRY_COMPARE(boxed.size(), 2);
+        QTest::ignoreMessage(QtWarningMsg, "nwidget: async_() computation failed: five");
+        s1.value() = 5;
+        QTRY_COMPARE(boxed.size(), 4);
+        QCOMPARE(boxed, QVector<int>({-1, 3, -1, 3}));
+    }
+
+    void testTimed()
+    {
+        QSlider _s1;
+        QSlider _s2;
+        QSlider _s3;
+
+        auto s1 = MetaObject<>::from(&_s1);
+        auto s2 = MetaObject<>::from(&_s2);
+        auto s3 = MetaObject<>::from(&_s3);
+
+        // debounce
+        QVector<int> values1;
+        debounce(s1.value(), 20).bindTo([&values1](int v) { values1.append(v); });
+        s1.value() = 1;
+        s1.value() = 2;
+        QCOMPARE(values1, QVector<int>({0}));
+        QTRY_COMPARE(values1, QVector<int>({0, 2}));
+
+        // throttle, the first change is yielded at once and opens a window
+        QVector<int> values2;
+        throttle(s2.value() * 2, 20).bindTo([&values2](int v) { values2.append(v); });
+        s2.value() = 3;
+        s2.value() = 4;
+        QCOMPARE(values2, QVector<int>({0, 6}));
+        QTRY_COMPARE(values2, QVector<int>({0, 6, 8}));
+
+        // sample
+        QVector<int> values3;
+        (sample(s3.value(), 20) + 1).bindTo([&values3](int v) { values3.append(v); });
+        s3.value() = 6;
+        s3.value() = 7;
+        QCOMPARE(values3, QVector<int>({1}));
+        QTRY_COMPARE(values3, QVector<int>({1, 8}));
+
+        // restarting a timer keeps the others of its slot
+        QSlider _s4;
+        QSlider _s5;
+
+        auto s4 = MetaObject<>::from(&_s4);
+        auto s5 = MetaObject<>::from(&_s5);
+
+        QVector<int> values4;
+        debounce(s4.value(), 20).bindTo([&values4](int v) { values4.append(v); });
+        debounce(s5.value(), 20).bindTo([&values4](int v) { values4.append(v); });
+        s4.value() = 1;
+        s5.value() = 2;
+        s4.value() = 3;
+        QTRY_COMPARE(values4.size(), 4);
+        QCOMPARE(values4, QVector<int>({0, 0, 2, 3}));
+    }
+
+    void testAggregate()
+    {
+        using Prop = decltype(std::declval<MetaObject<QSlider>>().value());
+
+        QVector<QSlider*> sliders;
+        QVector<Prop>     props;
+        for (int i = 0; i < 4; ++i) {
+            sliders.append(new QSlider);
+            sliders.last()->setValue(i);
+            props.append(MetaObject<>::from(sliders.last()).value());
+        }
+
+        QSlider _sum;
+        auto    sum = MetaObject<>::from(&_sum);
+        sum.value() = sum_(props);
+        QCOMPARE(sum.value().get(), 6);
+
+        auto min   = min_(props);
+        auto max   = max_(props);
+        auto count = count_if_(props, [](int v) { return v % 2 == 0; });
+        auto any   = any_(props);
+        auto all   = all_(props);
+        QCOMPARE(min.eval(), 0);
+        QCOMPARE(max.eval(), 3);
+        QCOMPARE(count.eval(), 2);
+        QCOMPARE(any.eval(), true);
+        QCOMPARE(all.eval(), false);
+
+        props[0] = 10;
+        QCOMPARE(sum.value().get(), 16);
+        QCOMPARE(min.eval(), 1);
+        QCOMPARE(max.eval(), 10);
+        QCOMPARE(count.eval(), 2);
+        QCOMPARE(all.eval(), true);
+
+        // destroyed properties leave the aggregates
+        delete sliders[0];
+        QCOMPARE(sum.value().get(), 6);
+        QCOMPARE(max.eval(), 3);
+        QCOMPARE(count.eval(), 1);
+
+        // readers run once every element is updated
+        QSlider _source;
+        auto    source = MetaObject<>::from(&_source);
+        props[1]       = source.value();
+        props[2]       = source.value();
+        QVector<int> sums;
+        sum_(props.mid(1)).bindTo([&sums](int v) { sums.append(v); });
+        source.value() = 5;
+        QCOMPARE(sums, QVector<int>({3, 13}));
+
+        // inside a construction the elements are evaluated before the fold is read
+        QSlider _total;
+        auto    total = MetaObject<>::from(&_total);
+        Construction::build(
+            [&]()
+            {
+                props[3]      = source.value();
+                total.value() = sum_(props.mid(1));
+            });
+        QCOMPARE(total.value().get(), 15);
+
+        qDeleteAll(sliders.mid(1));
+    }
+
+    void testComputed()
+    {
+        QSlider _s1;
+        QSlider _s2;
+        QSlider _s3;
+        QSlider _s4;
+
+        auto s1 = MetaObject<>::from(&_s1);
+        auto s2 = MetaObject<>::from(&_s2);
+        auto s3 = MetaObject<>::from(&_s3);
+        auto s4 = MetaObject<>::from(&_s4);
+
+        Computed<int> computed = invoke(&counted<int>, s1.value()) * 2;
+        QCOMPARE(calls, 1);
+
+        s2.value() = computed;
+        s3.value() = computed + 1;
+        s4.value() = computed + computed;
+        QCOMPARE(calls, 1);
+        QCOMPARE(s4.value().get(), 0);
+
+        // evaluated once per change whatever the number of readers
+        s1.value() = 2;
+        QCOMPARE(calls, 2);
+        QCOMPARE(computed.get(), 4);
+        QCOMPARE(s2.value().get(), 4);
+        QCOMPARE(s3.value().get(), 5);
+        QCOMPARE(s4.value().get(), 8);
+    }
+
+    void testValue()
+    {
+        QSlider _s1;
+        auto    s1 = MetaObject<>::from(&_s1);
+
+        Value<int> value = 1;
+        Value<int> copy  = value;
+        s1.value()       = value * 2;
+        QCOMPARE(s1.value().get(), 2);
+
+        int count = 0;
+        (value + 1).bindTo([&count](int) { ++count; });
+        QCOMPARE(count, 1);
+
+        value = 3;
+        QCOMPARE(s1.value().get(), 6);
+        QCOMPARE(copy.get(), 3);
+        QCOMPARE(count, 2);
+
+        // equal values are dropped
+        copy = 3;
+        QCOMPARE(count, 2);
+
+        copy.set(4);
+        QCOMPARE(s1.value().get(), 8);
+        QCOMPARE(count, 3);
+
+        // assigning another value keeps the cell and its readers
+        Value<int> other = 5;
+        value            = other;
+        QCOMPARE(s1.value().get(), 10);
+        QCOMPARE(count, 4);
+        other = 6;
+        QCOMPARE(value.get(), 5);
+    }
+
+    void testEventNotify()
+    {
+        QWidget _w;
+        QSlider _s1;
+        QSlider _s2;
+
+        auto w  = MetaObject<>::from(&_w);
+        auto s1 = MetaObject<>::from(&_s1);
+        auto s2 = MetaObject<>::from(&_s2);
+
+        _w.resize(100, 50);
+        _w.move(10, 0);
+        _w.show();
+        s1.value() = w.width() / 10;
+        s2.value() = w.font().m(&QFont::pointSize);
+        QCOMPARE(s1.value().get(), 10);
+
+        // notified by QEvent::Resize and QEvent::FontChange
+        _w.resize(200, 50);
+        QCOMPARE(s1.value().get(), 20);
+
+        s1.value() = w.x() + 1;
+        QCOMPARE(s1.value().get(), 11);
+
+        // notified by QEvent::Move
+        _w.move(20, 0);
+        QCOMPARE(s1.value().get(), 21);
+
+        QFont font = _w.font();
+        font.setPointSize(30);
+        _w.setFont(font);
+        QCOMPARE(s2.value().get(), 30);
+
+        // mapped for a class and its subclasses, after a first read
+        QLabel _label("a");
+        auto   label = MetaObject<>::from(&_label);
+
+        int before = 0;
+        int after  = 0;
+        makeBindingExpr(label.sizeHint()).bindTo([&before](const QSize& v) { before = v.width(); });
+        notifyOnEvent<QWidget>("sizeHint", QEvent::LayoutRequest);
+        makeBindingExpr(label.sizeHint()).bindTo([&after](const QSize& v) { after = v.width(); });
+        const int width = after;
+
+        _label.setText("a longer text");
+        QEvent request(QEvent::LayoutRequest);
+        QCoreApplication::sendEvent(&_label, &request);
+        QVERIFY(after > width);
+        QCOMPARE(before, width);
+    }
+
+    void testSharedNotify()
+    {
+        QAction _action;
+        auto    action = MetaObject<>::from(&_action);
+
+        // lazy_invoke is not cut off, so it counts every evaluation
+        int count1 = 0;
+        int count2 = 0;
+        lazy_invoke(
+            [&count1](const auto& v)
+            {
+                ++count1;
+                return v();
+            },
+            action.statusTip())
+            .bindTo([](const QString&) {});
+        QCOMPARE(count1, 1);
+
+        // QAction::changed also notifies text, a single observed property is filtered as well
+        _action.setText("text");
+        QCOMPARE(count1, 1);
+
+        lazy_invoke(
+            [&count2](const auto& v)
+            {
+                ++count2;
+                return v();
+            },
+            action.whatsThis())
+            .bindTo([](const QString&) {});
+        QCOMPARE(count2, 1);
+
+        // only the readers of the changed property are woken
+        _action.setStatusTip("status");
+        QCOMPARE(count1, 2);
+        QCOMPARE(count2, 1);
+
+        // readers take the value compared by the filter, the getter runs once per signal
+        MyDocument _document;
+        auto       document = MetaObject<>::from(&_document);
+
+        QString title;
+        makeBindingExpr(document.title()).bindTo([&title](const QString& v) { title = v; });
+        const int reads = _document.reads;
+
+        _document.setTitle("title");
+        QCOMPARE(title, QString("title"));
+        QCOMPARE(_document.reads, reads + 1);
+
+        _document.setBody("body");
+        QCOMPARE(_document.reads, reads + 2);
+    }
+
+    void testNotifyPayload()
+    {
+        MyCounter _counter;
+        QSlider   _s1;
+        QSlider   _s2;
+
+        auto counter = MetaObject<>::from(&_counter);
+        auto s1      = MetaObject<>::from(&_s1);
+        auto s2      = MetaObject<>::from(&_s2);
+
+        s1.value() = counter.value() + 1;
+        s2.value() = counter.value() * 2;
+        QCOMPARE(_counter.reads, 2);
+
+        // both readers use the argument of valueChanged(int)
+        _counter.setValue(3);
+        QCOMPARE(s1.value().get(), 4);
+        QCOMPARE(s2.value().get(), 6);
+        QCOMPARE(_counter.reads, 2);
+
+        // outside of the propagation the getter is called
+        QCOMPARE(makeBindingExpr(counter.value()).eval(), 3);
+        QCOMPARE(_counter.reads, 3);
+    }
+
+    void testBindingHandle()
+    {
+        QSlider _s1;
+        QSlider _s2;
+
+        auto s1 = MetaObject<>::from(&_s1);
+        auto s2 = MetaObject<>::from(&_s2);
+
+        BindingHandle handle = invoke(&counted<int>, s1.value()).bindTo(s2.value());
+        QVERIFY(handle.isBound());
+        QCOMPARE(calls, 1);
+
+        // suspended bindings catch up once
+        handle.suspend();
+        s1.value() = 1;
+        s1.value() = 2;
+        QCOMPARE(calls, 1);
+        QCOMPARE(s2.value().get(), 0);
+        handle.resume();
+        QCOMPARE(calls, 2);
+        QCOMPARE(s2.value().get(), 2);
+
+        BindingHandle moved = std::move(handle);
+        QVERIFY(!handle.isBound());
+        moved.unbind();
+        QVERIFY(!moved.isBound());
+        s1.value() = 3;
+        QCOMPARE(s2.value().get(), 2);
+
+        // reset once the binding is deleted with its source
+        {
+            auto          _s3    = new QSlider;
+            auto          s3     = MetaObject<>::from(_s3);
+            ScopedBinding scoped = s3.value().bindTo(s2.value());
+            QVERIFY(scoped.isBound());
+            delete _s3;
+            QVERIFY(!scoped.isBound());
+        }
+
+        {
+            ScopedBinding scoped = (s1.value() + 1).bindTo(s2.value());
+            QCOMPARE(s2.value().get(), 4);
+        }
+        s1.value() = 5;
+        QCOMPARE(s2.value().get(), 4);
+
+        // binding the target again leaves the handle of the previous expression and its suspension behind
+        BindingHandle first = (s1.value() * 2).bindTo(s2.value());
+        first.suspend();
+        BindingHandle second = (s1.value() * 3).bindTo(s2.value());
+        QVERIFY(!first.isBound());
+        QVERIFY(second.isBound());
+        QCOMPARE(s2.value().get(), 15);
+        s1.value() = 6;
+        QCOMPARE(s2.value().get(), 18);
+    }
+
+    void testSuspendBindings()
+    {
+        QWidget root;
+        QSlider _s1;
+        auto    _s2 = new QSlider(&root);
+        auto    _s3 = new QSlider(&root);
+
+        auto s1 = MetaObject<>::from(&_s1);
+        auto s2 = MetaObject<>::from(_s2);
+        auto s3 = MetaObject<>::from(_s3);
+
+        s2.value() = invoke(&counted<int>, s1.value());
+        s3.value() = s1.value() * 2;
+        QCOMPARE(calls, 1);
+
+        // dirty bindings are evaluated once on resume
+        suspendBindings(&root);
+        s1.value() = 1;
+        s1.value() = 2;
+        s1.value() = 3;
+        QCOMPARE(calls, 1);
+        QCOMPARE(s2.value().get(), 0);
+        QCOMPARE(s3.value().get(), 0);
+
+        root.show();
+        QCOMPARE(s2.value().get(), 0);
+
+        resumeBindings(&root);
+        QCOMPARE(calls, 2);
+        QCOMPARE(s2.value().get(), 3);
+        QCOMPARE(s3.value().get(), 6);
+
+        s1.value() = 4;
+        QCOMPARE(s2.value().get(), 4);
+    }
+
+    void testTwoWay()
+    {
+        QSlider _s1;
+        QSlider _s2;
+        _s2.setRange(0, 1000);
+
+        auto s1 = MetaObject<>::from(&_s1);
+        auto s2 = MetaObject<>::from(&_s2);
+
+        auto fwd  = [](int v) { return counted(v) * 10; };
+        auto back = [](int v) { return (v + 5) / 10; };
+
+        s1.value()   = 3;
+        auto handles = twoWay(s1.value(), s2.value(), +fwd, +back);
+        QVERIFY(handles.first.isBound());
+        QVERIFY(handles.second.isBound());
+        QCOMPARE(s1.value().get(), 3);
+        QCOMPARE(s2.value().get(), 30);
+
+        s1.value() = 5;
+        QCOMPARE(s2.value().get(), 50);
+
+        // not written back within the same propagation, even though back does not round trip
+        calls      = 0;
+        s2.value() = 37;
+        QCOMPARE(s1.value().get(), 4);
+        QCOMPARE(s2.value().get(), 37);
+        QCOMPARE(calls, 1);
+
+        s1.value() = 5;
+        QCOMPARE(s2.value().get(), 50);
+
+        handles.second.unbind();
+        s2.value() = 70;
+        QCOMPARE(s1.value().get(), 5);
+
+#if N_BINDING_CYCLE_LIMIT > 0
+        // a cycle without a guard is reported and stopped instead of spinning
+        QSlider _s3;
+        QSlider _s4;
+        _s3.setObjectName("s3");
+        _s4.setObjectName("s4");
+        _s3.setRange(0, 100000);
+        _s4.setRange(0, 100000);
+
+        auto s3 = MetaObject<>::from(&_s3);
+        auto s4 = MetaObject<>::from(&_s4);
+
+        // closed by the first evaluation of the second binding, which misses the change of s4 it caused
+        const QRegularExpression cycle("^nwidget: binding cycle QSlider\\(s[34]\\)\\.value -> .*, propagation stopped");
+        QTest::ignoreMessage(QtWarningMsg, cycle);
+        s4.value() = s3.value() + 1;
+        s3.value() = s4.value() + 1;
+        QVERIFY(s3.value().get() < 4 * N_BINDING_CYCLE_LIMIT);
+
+        // stopped after one of the bindings wrote its target
+        const int v3 = s3.value().get();
+        const int v4 = s4.value().get();
+        QVERIFY2(v4 == v3 + 1 || v3 == v4 + 1, qPrintable(QString("s3 %1, s4 %2").arg(v3).arg(v4)));
+
+        // a cycle through queued bindings spans event loop turns, it is counted within its propagation
+        QSlider _s5;
+        QSlider _s6;
+        _s5.setObjectName("s5");
+        _s6.setObjectName("s6");
+        _s5.setRange(0, 100000);
+        _s6.setRange(0, 100000);
+
+        auto s5 = MetaObject<>::from(&_s5);
+        auto s6 = MetaObject<>::from(&_s6);
+
+        const QRegularExpression loop("^nwidget: binding cycle QSlider\\(s[56]\\)\\.value -> .*, propagation stopped");
+        QTest::ignoreMessage(QtWarningMsg, loop);
+        (s5.value() + 1).bindTo(s6.value(), Qt::QueuedConnection);
+        (s6.value() + 1).bindTo(s5.value(), Qt::QueuedConnection);
+
+        // stopped once the value is left unchanged between two polls
+        int  v5     = -1;
+        auto stable = [&]()
+        {
+            const int last = v5;
+            v5             = s5.value().get();
+            return v5 == last;
+        };
+        QTRY_VERIFY_WITH_TIMEOUT(stable(), 10000);
+        QVERIFY(v5 >= N_BINDING_CYCLE_LIMIT);
+        QVERIFY(v5 < 4 * N_BINDING_CYCLE_LIMIT);
+#endif
+    }
+
+    void testMemo()
+    {
+        QSlider _s1;
+        QLabel  _l1;
+
+        auto s1 = MetaObject<>::from(&_s1);
+        auto l1 = MetaObject<>::from(&_l1);
+
+        const auto text = memo_<2>(invoke(&counted<QString>, asprintf_("%d", s1.value())));
+        l1.text()       = text;
+        QCOMPARE(calls, 1);
+        QCOMPARE(l1.text().get(), QString("0"));
+
+        // toggling arguments are served from the cache
+        s1.value() = 1;
+        s1.value() = 0;
+        s1.value() = 1;
+        QCOMPARE(calls, 2);
+        QCOMPARE(l1.text().get(), QString("1"));
+        QCOMPARE(memoHits(text), qint64(2));
+        QCOMPARE(memoMisses(text), qint64(2));
+
+        // least recently used results are evicted
+        s1.value() = 2;
+        s1.value() = 1;
+        QCOMPARE(calls, 3);
+        s1.value() = 0;
+        QCOMPARE(calls, 4);
+        QCOMPARE(l1.text().get(), QString("0"));
+        QCOMPARE(memoHits(text), qint64(3));
+        QCOMPARE(memoMisses(text), qint64(4));
+
+        // a parent node still reads the cache
+        l1.text() = text + "!";
+        QCOMPARE(calls, 4);
+        QCOMPARE(l1.text().get(), QString("0!"));
+        QCOMPARE(memoHits(text), qint64(4));
+        QVERIFY(memoHits() >= 4);
+        QVERIFY(memoMisses() >= 4);
+
+        // constant arguments, as a capturing function, are not part of the key
+        QSlider    _s2;
+        auto       s2     = MetaObject<>::from(&_s2);
+        const int  factor = 3;
+        const auto scaled = memo_(invoke([factor](int v) { return v * factor; }, s1.value()));
+        s2.value()        = scaled;
+        s1.value()        = 1;
+        QCOMPARE(s2.value().get(), 3);
+        s1.value() = 0;
+        QCOMPARE(s2.value().get(), 0);
+        QCOMPARE(memoHits(scaled), qint64(1));
+        QCOMPARE(memoMisses(scaled), qint64(2));
     }
 };
 